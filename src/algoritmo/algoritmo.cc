@@ -2,16 +2,71 @@
 
 /**
  * @brief Método para sumar las distancia de los puntos seleccionados
- * @param espacio Espacio vectorial
+ * @param seleccion Índices de los puntos seleccionados
+ * @details Se evalúa siempre en precisión doble sobre las coordenadas originales, para
+ * que el valor que se informa sea exacto aunque la búsqueda use precisión simple
  * @return Distancia total
  */
-double Algoritmo::calcularDistancia(const EspacioVectorial& espacio) {
+double Algoritmo::calcularDistancia(const vector<int>& seleccion) const {
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  const Metrica metrica = dato_->distancias.getMetrica();
   double distancia = 0.0;
-  size_t n = espacio.getDimension();
-  for (size_t i = 0; i < n - 1; ++i) {
-    for (size_t j = i + 1; j < n; ++j) {
-      distancia += espacio[i].calcularDistancia(espacio[j]);
+  for (size_t i = 0; i + 1 < seleccion.size(); ++i) {
+    for (size_t j = i + 1; j < seleccion.size(); ++j) {
+      distancia += espacio[seleccion[i]].calcularDistancia(espacio[seleccion[j]], metrica);
     }
   }
   return distancia;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Método para evaluar la función objetivo de los puntos seleccionados
+ * @param seleccion Índices de los puntos seleccionados
+ * @details Como calcularDistancia, en precisión doble sobre las coordenadas originales
+ * @return Valor de la función objetivo
+ */
+double Algoritmo::calcularObjetivo(const vector<int>& seleccion) const {
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  const Metrica metrica = dato_->distancias.getMetrica();
+  auto distancia = [&espacio, metrica](int a, int b) { return espacio[a].calcularDistancia(espacio[b], metrica); };
+  return conObjetivo(objetivo_, [&](auto politica) {
+    politica.preparar(distancia, seleccion);
+    return politica.final(politica.valor(), seleccion.size());
+  });
+}
+
+/**
+ * @brief Método para construir el resultado de una ejecución
+ * @param seleccion Índices de los puntos seleccionados
+ * @param tiempoCPU Tiempo de CPU de la ejecución
+ * @details El valor objetivo se calcula aquí, una sola vez por ejecución. La memoria de
+ * las tablas es la de las distancias de la instancia; cada algoritmo añade las suyas
+ * @return Resultado con los datos comunes a todos los algoritmos
+ */
+Resultado Algoritmo::construirResultado(const vector<int>& seleccion, double tiempoCPU) const {
+  Resultado resultado;
+  resultado.dato = dato_;
+  resultado.algoritmo = getNombre();
+  resultado.objetivo = objetivo_;
+  resultado.numPuntosAlejados = seleccion.size();
+  resultado.z = calcularObjetivo(seleccion);
+  resultado.tiempoCPU = tiempoCPU;
+  if (medirMemoria_) {
+    resultado.memoriaMaxima = memoriaMaxima();
+  }
+  resultado.memoriaTablas = dato_->distancias.getBytes() + dato_->matrizDistancias.getBytes();
+  resultado.seleccion = seleccion;
+  return resultado;
+}
+
+/**
+ * @brief Método para obtener los índices de todos los puntos de la instancia
+ * @return vector<int> Índices 0..n-1
+ */
+vector<int> Algoritmo::indicesInstancia() const {
+  vector<int> indices(dato_->espacioVectorial.getDimension());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    indices[i] = i;
+  }
+  return indices;
+}
@@ -6,8 +6,12 @@
 #define C_Algoritmo_H
 
 #include "../dato/dato.h"
+#include "../resultado/resultado.h"
+#include "../memoria/memoria.h"
 #include <iomanip>
 #include <chrono> // Para medir el tiempo de ejecución
+#include <memory> // Para make_unique
+#include <utility> // Para exchange
 
 class Algoritmo {
   public:
@@ -20,22 +24,32 @@ class Algoritmo {
 
     // Métodos de la clase
     virtual void ejecutar() = 0;
-    virtual void mostrarResultados() = 0;
+    virtual string getNombre() const = 0;
 
-    double calcularDistancia(const EspacioVectorial& espacio);
+    double calcularDistancia(const vector<int>& seleccion) const;
+    double calcularObjetivo(const vector<int>& seleccion) const;
 
     // Getters
-    inline vector<Dato>& getResultados() { return resultados_; }
+    inline vector<Resultado>& getResultados() { return resultados_; }
+    inline vector<Resultado> extraerResultados() { return exchange(resultados_, {}); }
 
     // Setters
     inline void setDato(Dato& dato) { dato_ = &dato; }
     inline void setNumPuntosAlejados(const int numPuntosAlejados) { numPuntosAlejados_ = numPuntosAlejados; }
+    inline void setObjetivo(const TipoObjetivo objetivo) { objetivo_ = objetivo; }
+    inline void setMedirMemoria(const bool medirMemoria) { medirMemoria_ = medirMemoria; }
 
   protected:
+    inline void iniciarMedicionMemoria() const { if (medirMemoria_) reiniciarMemoriaMaxima(); }
+    Resultado construirResultado(const vector<int>& seleccion, double tiempoCPU) const;
+    vector<int> indicesInstancia() const;
+
     // Datos importantes para el algoritmo
     Dato* dato_;
-    vector<Dato> resultados_;
+    vector<Resultado> resultados_;
     int numPuntosAlejados_;
+    TipoObjetivo objetivo_ = TipoObjetivo::Suma; // Función objetivo que se maximiza
+    bool medirMemoria_ = true; // Si cada ejecución reinicia y mide el pico de memoria del proceso (no en las anidadas ni en las concurrentes)
 };
 
 #endif
\ No newline at end of file
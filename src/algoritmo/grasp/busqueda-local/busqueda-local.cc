@@ -2,37 +2,55 @@
 
 /**
  * @brief Método para calcular el delta Z de la mejora
- * @param i Índice del primer punto
- * @param j Índice del segundo punto
- * @return void
+ * @param distancia Núcleo de distancia de la instancia
+ * @param i Posición en la solución del punto que sale
+ * @param j Índice del punto que entra
+ * @details El estado de la función objetivo debe estar preparado para la solución actual
+ * @return Variación de la función objetivo al intercambiar los dos puntos
  */
-double BusquedaLocal::calcularDeltaZ(int i, int j) const {
-  const Punto& punto_i = subconjunto_->operator[](i);
-  const Punto& punto_j = espacioVectorial_[j];
-  return punto_i.calcularDistancia(punto_j);
+template <class Objetivo>
+template <class Distancia>
+double BusquedaLocal<Objetivo>::calcularDeltaZ(const Distancia& distancia, int i, int j) const {
+  return objetivo_.cambiar(distancia, subconjunto_, i, j) - objetivo_.valor();
 }
 
 
 /**
  * @brief Método que realiza las búsquedas locales
+ * @details El núcleo de distancia se elige una sola vez para toda la búsqueda
  * @return void
  */
-void BusquedaLocal::swap1LocalSearch() {
+template <class Objetivo>
+void BusquedaLocal<Objetivo>::swap1LocalSearch() {
+  distancias_.conNucleo([this](const auto& distancia) { swap1LocalSearch(distancia); });
+}
+
+/**
+ * @brief Método que realiza las búsquedas locales con un núcleo de distancia fijo
+ * @param distancia Núcleo de distancia de la instancia
+ * @return void
+ */
+template <class Objetivo>
+template <class Distancia>
+void BusquedaLocal<Objetivo>::swap1LocalSearch(const Distancia& distancia) {
   // Inicializar variables
   double mejor_delta = 0;
   pair<int, int> mejor_swap = {-1, -1}; // Inicializa el mejor swap como ninguno
   
-  vector<pair<int, int>> realizados; // Para evitar swaps repetidos
+  vector<bool> enSolucion(distancias_.getNumPuntos(), false);
+  for (const auto& indice : subconjunto_) {
+    enSolucion[indice] = true;
+  }
   
   do {
-    mejor_delta = 0;
+    objetivo_.preparar(distancia, subconjunto_);
+    mejor_delta = 1e-9; // Solo se aceptan mejoras por encima del error de redondeo
     mejor_swap = {-1, -1}; // Reinicia el mejor swap
 
-    for (size_t i = 0; i < subconjunto_->getDimension(); ++i) {
-      for (size_t j = 0; j < espacioVectorial_.getDimension(); ++j) {
-        if (subconjunto_->operator[](i) != espacioVectorial_[j] && 
-            find(realizados.begin(), realizados.end(), make_pair(static_cast<int>(i), static_cast<int>(j))) == realizados.end()) {
-          double delta_z = calcularDeltaZ(i, j); // Mejora de intercambiar i por j
+    for (size_t i = 0; i < subconjunto_.size(); ++i) {
+      for (size_t j = 0; j < distancias_.getNumPuntos(); ++j) {
+        if (!enSolucion[j]) {
+          double delta_z = calcularDeltaZ(distancia, i, j); // Mejora de intercambiar i por j
 
           if (delta_z > mejor_delta) {
             mejor_delta = delta_z;
@@ -41,22 +59,28 @@ void BusquedaLocal::swap1LocalSearch() {
         }
       }
     }
-    if (mejor_delta > 0) {
+    if (mejor_swap.first != -1) {
       // Aplicar el mejor swap
-      realizados.push_back(mejor_swap); // Registrar el swap realizado
-      swap(subconjunto_->operator[](mejor_swap.first), espacioVectorial_[mejor_swap.second]);
+      enSolucion[subconjunto_[mejor_swap.first]] = false;
+      enSolucion[mejor_swap.second] = true;
+      subconjunto_[mejor_swap.first] = mejor_swap.second;
     }
-  } while (mejor_delta > 0);
+  } while (mejor_swap.first != -1);
 }
 
 /**
  * @brief Método para realizar la búsqueda local 1-swap Local Search
  * @return void
 */
-void BusquedaLocal::mejorarRutas() {
+template <class Objetivo>
+void BusquedaLocal<Objetivo>::mejorarRutas() {
   // Realizar la búsqueda local
   swap1LocalSearch();
 }
+
+template class BusquedaLocal<ObjetivoSuma>;
+template class BusquedaLocal<ObjetivoMinimo>;
+template class BusquedaLocal<ObjetivoMedia>;
 //Entrada: solución inicial S (conjunto de m elementos), conjunto total U
 //Salida: solución S mejorada (óptimo local)
 //
@@ -1,5 +1,8 @@
 /**
  * @class Clase para realizar las busquedas locales
+ * @details Objetivo es la política de la función objetivo (ver objetivo.h); las
+ * variaciones de cada intercambio se calculan con sus ganchos incrementales. La búsqueda
+ * se instancia también con el núcleo de distancia de la instancia (Distancias::conNucleo)
  */
 
 #ifndef BUSQUEDA_LOCAL_H
@@ -7,22 +10,26 @@
 
 #include "../grasp.h"
 
+template <class Objetivo>
 class BusquedaLocal {
   public:
     // Constructor
-    BusquedaLocal(const EspacioVectorial& espacioVectorial, EspacioVectorial* subconjunto)
-      : espacioVectorial_(espacioVectorial), subconjunto_(subconjunto) {}
+    BusquedaLocal(const Distancias& distancias, vector<int>& subconjunto)
+      : distancias_(distancias), subconjunto_(subconjunto) {}
 
     // Método para realizar la búsqueda local
     void mejorarRutas();
-    double calcularDeltaZ(int i, int j) const;
 
     // Búsqueda local
     void swap1LocalSearch();
     
   private:
-    EspacioVectorial* subconjunto_;
-    EspacioVectorial espacioVectorial_;
+    template <class Distancia> void swap1LocalSearch(const Distancia& distancia);
+    template <class Distancia> double calcularDeltaZ(const Distancia& distancia, int i, int j) const;
+
+    const Distancias& distancias_; // Distancias de la instancia compartida (no se copia)
+    vector<int>& subconjunto_; // Índices de la solución que se mejora
+    Objetivo objetivo_; // Estado de la función objetivo para la solución actual
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -2,34 +2,30 @@
 
 /**
  * @brief Método para calcular el punto más alejado del centro de gravedad
- * @param espacio Espacio vectorial
+ * @param candidatos Índices de los puntos aún no seleccionados
  * @param centroGravedad Centro de gravedad
  * @details Se escoge al azar entre los n puntos más alejados del centro de gravedas
- * @return Punto más alejado del centro de gravedad
+ * @return Posición en candidatos del punto escogido
  */
-Punto* Grasp::puntoMasAlejado(EspacioVectorial& espacio, const Punto& centroGravedad) const {
+size_t Grasp::puntoMasAlejado(const vector<int>& candidatos, const Punto& centroGravedad) {
   double maxDistancia = -1;
-  vector<Punto*> puntosMasAlejados;
+  vector<size_t> puntosMasAlejados;
 
-  for (size_t i = 0; i < espacio.getDimension(); ++i) {
-    double distancia = espacio[i].calcularDistancia(centroGravedad);
-    if (puntosMasAlejados.size() == mejoresPuntos_) break;
-    if (distancia > maxDistancia) {
-      Punto* punto = &espacio[i];
-      maxDistancia = distancia;
-      // Compruebo si el punto ya está en la lista de puntos más alejados
-      if (find(puntosMasAlejados.begin(), puntosMasAlejados.end(), punto) == puntosMasAlejados.end()) {
-        puntosMasAlejados.push_back(punto);
+  dato_->distancias.conNucleo([&](const auto& distancias) {
+    for (size_t i = 0; i < candidatos.size(); ++i) {
+      double distancia = distancias(candidatos[i], centroGravedad);
+      if (puntosMasAlejados.size() == mejoresPuntos_) break;
+      if (distancia > maxDistancia) {
+        maxDistancia = distancia;
+        puntosMasAlejados.push_back(i);
       }
     }
-  }
+  });
 
   // Escoger un punto aleatorio entre los n puntos más alejados
-  static std::random_device rd; // Obtiene un número aleatorio
-  static std::mt19937 gen(rd()); // Generador de números aleatorios
   std::uniform_int_distribution<> dis(0, puntosMasAlejados.size() - 1);
   
-  return puntosMasAlejados[dis(gen)];
+  return puntosMasAlejados[dis(generador_)];
 }
 
 /**
@@ -37,77 +33,40 @@ Punto* Grasp::puntoMasAlejado(EspacioVectorial& espacio, const Punto& centroGrav
  * @return void
  */
 void Grasp::ejecutar() {
+  iniciarMedicionMemoria();
   auto start = chrono::high_resolution_clock::now();
-  Dato resultado = *dato_;
-  EspacioVectorial subconjunto;
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  vector<int> candidatos = indicesInstancia();
+  vector<int> subconjunto;
 
   // Obtengo el centro de gravedad
-  Punto centroGravedad = dato_->espacioVectorial.calcularCentroGravedad();
+  Punto centroGravedad = espacio.calcularCentroGravedad();
 
   do {
     // Calculo el punto más alejado del centro de gravedad
-    Punto* puntoMasAlejado = this->puntoMasAlejado(resultado.espacioVectorial, centroGravedad);
+    size_t puntoMasAlejado = this->puntoMasAlejado(candidatos, centroGravedad);
 
     // Agrego el punto más alejado al resultado
-    subconjunto.agregarPunto(*puntoMasAlejado);
+    subconjunto.push_back(candidatos[puntoMasAlejado]);
 
-    // Elimino el punto más alejado del espacio vectorial
-    resultado.espacioVectorial.eliminarPunto(*puntoMasAlejado);
+    // Elimino el punto más alejado de los candidatos
+    candidatos.erase(candidatos.begin() + puntoMasAlejado);
 
     // Calculo el nuevo centro de gravedad
-    centroGravedad = subconjunto.calcularCentroGravedad();
+    centroGravedad = espacio.calcularCentroGravedad(subconjunto);
 
-  } while (subconjunto.getDimension() != numPuntosAlejados_);
+  } while (subconjunto.size() != numPuntosAlejados_);
 
-  resultado.espacioVectorial = subconjunto;
   // Realizo la búsqueda local
-  BusquedaLocal busquedaLocal(dato_->espacioVectorial, &resultado.espacioVectorial);
-  busquedaLocal.mejorarRutas();
+  conObjetivo(objetivo_, [&](auto politica) {
+    BusquedaLocal<decltype(politica)> busquedaLocal(dato_->distancias, subconjunto);
+    busquedaLocal.mejorarRutas();
+  });
   auto end = chrono::high_resolution_clock::now();
-  resultado.tiempoCPU = chrono::duration<double>(end - start).count(); // Tiempo en segundos
+  double tiempoCPU = chrono::duration<double>(end - start).count(); // Tiempo en segundos
 
   // Agrego el resultado al vector de resultados
-  resultados_.push_back(resultado);
+  Resultado registro = construirResultado(subconjunto, tiempoCPU);
+  registro.tamanioLRC = mejoresPuntos_;
+  resultados_.push_back(registro);
 }
-
-/**
- * @brief Método para mostrar los resultados del algoritmo GRASP
- * @return void
- */
-void Grasp::mostrarResultados() {
-  static bool cabeceraMostrada = false;
-
-  if (!cabeceraMostrada) {
-    // Cabecera
-    cout << "-----------------------------------------------------------------------------" << endl;
-    cout << left 
-    << setw(20) << "Problema" 
-    << setw(6) << "n" 
-    << setw(6) << "K" 
-    << setw(6) << "m" 
-    << setw(10) << "|LRC|"
-    << setw(12) << "z"
-    << setw(12) << "Tiempo CPU" 
-    << setw(6) << "S"
-    << endl;
-    cout << "-----------------------------------------------------------------------------" << endl;
-    cabeceraMostrada = true;
-  }
-
-  // Muestro los resultados
-  int LRC = 2;
-  for (auto& resultado : resultados_) {
-    if (LRC > 3) LRC = 2;
-    cout << left 
-    << setw(20) << resultado.nombreFichero 
-    << setw(6) << resultado.numPuntos
-    << setw(6) << resultado.tamanio
-    << setw(6) << resultado.espacioVectorial.getDimension()
-    << setw(10) << LRC++
-    << setw(12) << fixed << setprecision(2) << calcularDistancia(resultado.espacioVectorial)
-    << setw(12) << fixed << setprecision(5) << resultado.tiempoCPU
-    << setw(0) << resultado.espacioVectorial
-    << endl;
-  }
-  cout << "-----------------------------------------------------------------------------" << endl;
-}
\ No newline at end of file
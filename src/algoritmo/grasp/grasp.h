@@ -15,15 +15,17 @@ class Grasp : public Algoritmo {
 
     // Métodos de la clase
     void ejecutar() override;
-    void mostrarResultados() override;
+    inline string getNombre() const override { return "GRASP"; }
 
     // Setters
     inline void setMejoresPuntos(const int mejoresPuntos) { mejoresPuntos_ = mejoresPuntos; }
+    inline void setSemilla(const uint32_t semilla) { generador_.seed(semilla); }
     
   private:
-    Punto* puntoMasAlejado(EspacioVectorial& espacio, const Punto& centroGravedad) const;
+    size_t puntoMasAlejado(const vector<int>& candidatos, const Punto& centroGravedad);
     // Atributos
     int mejoresPuntos_ = 2;
+    mt19937 generador_{random_device{}()}; // Generador de números aleatorios (semilla aleatoria salvo setSemilla)
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include "lista-abierta.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Método para vaciar la lista y preparar ranuras para selecciones de hasta maxNivel puntos
+ * @param maxNivel Máximo número de puntos de una selección
+ * @return void
+ */
+void ListaAbierta::reiniciar(int maxNivel) {
+  maxNivel_ = max(1, maxNivel);
+  monticulo_.clear();
+  selecciones_.clear();
+  valores_.clear();
+  niveles_.clear();
+  libres_.clear();
+}
+
+/**
+ * @brief Método para obtener la memoria reservada por la lista
+ * @details Al vaciarla se conserva la memoria para reutilizarla, así que también cuenta
+ * la reservada en búsquedas anteriores
+ * @return size_t Bytes reservados
+ */
+size_t ListaAbierta::getBytes() const {
+  return monticulo_.capacity() * sizeof(Entrada) + selecciones_.capacity() * sizeof(int)
+    + valores_.capacity() * sizeof(double) + niveles_.capacity() * sizeof(int) + libres_.capacity() * sizeof(uint32_t);
+}
+
+/**
+ * @brief Método para obtener una ranura libre (reutilizada o nueva) con sus datos escalares
+ * @param valor Valor objetivo del nodo
+ * @param nivel Nivel del nodo
+ * @return Índice de la ranura
+ */
+uint32_t ListaAbierta::reservarRanura(double valor, int nivel) {
+  uint32_t ranura;
+  if (!libres_.empty()) {
+    ranura = libres_.back();
+    libres_.pop_back();
+    valores_[ranura] = valor;
+    niveles_[ranura] = nivel;
+  } else {
+    ranura = static_cast<uint32_t>(valores_.size());
+    valores_.push_back(valor);
+    niveles_.push_back(nivel);
+    selecciones_.resize(selecciones_.size() + maxNivel_);
+  }
+  return ranura;
+}
+
+/**
+ * @brief Método para insertar un nodo
+ * @param seleccion Puntos seleccionados (como mucho maxNivel)
+ * @param valor Valor objetivo del nodo
+ * @param cota Cota superior del nodo
+ * @param nivel Nivel del nodo
+ * @return void
+ */
+void ListaAbierta::insertar(const vector<int>& seleccion, double valor, double cota, int nivel) {
+  const uint32_t ranura = reservarRanura(valor, nivel);
+  copy(seleccion.begin(), seleccion.end(), selecciones_.begin() + ranura * maxNivel_);
+  monticulo_.push_back({cota, ranura});
+  subir(monticulo_.size() - 1);
+}
+
+/**
+ * @brief Método para insertar el hijo de un nodo sin construir su selección aparte
+ * @param seleccion Puntos seleccionados del padre
+ * @param punto Punto que se añade a la selección del padre
+ * @param valor Valor objetivo del hijo
+ * @param cota Cota superior del hijo
+ * @param nivel Nivel del hijo
+ * @return void
+ */
+void ListaAbierta::insertar(const vector<int>& seleccion, int punto, double valor, double cota, int nivel) {
+  const uint32_t ranura = reservarRanura(valor, nivel);
+  auto destino = copy(seleccion.begin(), seleccion.end(), selecciones_.begin() + ranura * maxNivel_);
+  *destino = punto;
+  monticulo_.push_back({cota, ranura});
+  subir(monticulo_.size() - 1);
+}
+
+/**
+ * @brief Método para extraer el nodo de mayor cota
+ * @param nodo Nodo donde se copia el extraído (se reutiliza su memoria)
+ * @return void
+ */
+void ListaAbierta::extraer(Nodo& nodo) {
+  const Entrada cima = monticulo_.front();
+  monticulo_.front() = monticulo_.back();
+  monticulo_.pop_back();
+  if (!monticulo_.empty()) bajar(0);
+
+  const auto inicio = selecciones_.begin() + cima.ranura * maxNivel_;
+  nodo.nivel = niveles_[cima.ranura];
+  nodo.valor = valores_[cima.ranura];
+  nodo.cota = cima.cota;
+  nodo.seleccion.assign(inicio, inicio + nodo.nivel);
+  libres_.push_back(cima.ranura);
+}
+
+/**
+ * @brief Método para eliminar de una vez todos los nodos cuya cota no supera un umbral
+ * @param umbral Valor de la mejor solución encontrada
+ * @details Se compacta el montículo en una pasada, se liberan las ranuras de los nodos
+ * eliminados y se reconstruye el montículo en tiempo lineal
+ * @return Número de nodos eliminados
+ */
+size_t ListaAbierta::podar(double umbral) {
+  size_t conservados = 0;
+  for (const auto& entrada : monticulo_) {
+    if (entrada.cota > umbral) {
+      monticulo_[conservados++] = entrada;
+    } else {
+      libres_.push_back(entrada.ranura);
+    }
+  }
+  const size_t eliminados = monticulo_.size() - conservados;
+  if (eliminados == 0) return 0;
+  monticulo_.resize(conservados);
+
+  // Si no queda nada se libera el almacén entero
+  if (monticulo_.empty()) {
+    reiniciar(static_cast<int>(maxNivel_));
+    return eliminados;
+  }
+  reconstruir();
+  return eliminados;
+}
+
+/**
+ * @brief Método para serializar los nodos de la lista
+ * @param salida Búfer al que se añaden los nodos
+ * @details Formato: maxNivel (int32) y número de nodos (uint64); por cada nodo su cota y
+ * su valor (double), su nivel (int32) y los nivel puntos de su selección (int32). Solo se
+ * guardan los nodos vivos, no las ranuras libres
+ * @return void
+ */
+void ListaAbierta::serializar(vector<char>& salida) const {
+  auto anadir = [&salida](const void* datos, size_t bytes) {
+    const char* inicio = static_cast<const char*>(datos);
+    salida.insert(salida.end(), inicio, inicio + bytes);
+  };
+  const int32_t maxNivel = static_cast<int32_t>(maxNivel_);
+  const uint64_t numNodos = monticulo_.size();
+  anadir(&maxNivel, sizeof(maxNivel));
+  anadir(&numNodos, sizeof(numNodos));
+  for (const auto& entrada : monticulo_) {
+    const int32_t nivel = niveles_[entrada.ranura];
+    anadir(&entrada.cota, sizeof(double));
+    anadir(&valores_[entrada.ranura], sizeof(double));
+    anadir(&nivel, sizeof(nivel));
+    anadir(&selecciones_[entrada.ranura * maxNivel_], nivel * sizeof(int32_t));
+  }
+}
+
+/**
+ * @brief Método para reconstruir la lista a partir de unos nodos serializados
+ * @param datos Búfer con el formato de serializar
+ * @param numPuntos Número de puntos de la instancia
+ * @param maxNivel Máximo número de puntos de una selección de la búsqueda que se reanuda
+ * @details El búfer puede venir de un fichero dañado o de otra búsqueda, así que no se
+ * confía en él: su maxNivel debe coincidir con el de la búsqueda, cada punto debe ser un
+ * índice de la instancia, el número de nodos debe caber en el búfer y el montículo se
+ * reconstruye en lugar de asumir que se guardó ordenado
+ * @return true si el búfer es válido; si no, la lista queda vacía
+ */
+bool ListaAbierta::cargar(const vector<char>& datos, int numPuntos, int maxNivel) {
+  const char* actual = datos.data();
+  const char* fin = datos.data() + datos.size();
+  auto leer = [&actual, fin](void* destino, size_t bytes) {
+    if (static_cast<size_t>(fin - actual) < bytes) return false;
+    memcpy(destino, actual, bytes);
+    actual += bytes;
+    return true;
+  };
+  auto rechazar = [this, maxNivel]() {
+    reiniciar(maxNivel);
+    return false;
+  };
+  reiniciar(maxNivel);
+  int32_t maxNivelGuardado;
+  uint64_t numNodos;
+  const size_t bytesNodoMinimo = 2 * sizeof(double) + sizeof(int32_t);
+  if (!leer(&maxNivelGuardado, sizeof(maxNivelGuardado)) || !leer(&numNodos, sizeof(numNodos))
+      || maxNivelGuardado != static_cast<int32_t>(maxNivel_)
+      || numNodos > static_cast<size_t>(fin - actual) / bytesNodoMinimo) {
+    return rechazar();
+  }
+  for (uint64_t i = 0; i < numNodos; ++i) {
+    double cota, valor;
+    int32_t nivel;
+    if (!leer(&cota, sizeof(cota)) || !leer(&valor, sizeof(valor)) || !leer(&nivel, sizeof(nivel))
+        || nivel < 0 || nivel > maxNivelGuardado) {
+      return rechazar();
+    }
+    const uint32_t ranura = reservarRanura(valor, nivel);
+    int* seleccion = &selecciones_[ranura * maxNivel_];
+    if (!leer(seleccion, nivel * sizeof(int32_t))
+        || any_of(seleccion, seleccion + nivel, [numPuntos](int v) { return v < 0 || v >= numPuntos; })) {
+      return rechazar();
+    }
+    monticulo_.push_back({cota, ranura});
+  }
+  if (actual != fin) {
+    return rechazar();
+  }
+  reconstruir();
+  return true;
+}
+
+/**
+ * @brief Método para subir una entrada hasta restaurar el montículo
+ * @param posicion Posición de la entrada
+ * @return void
+ */
+void ListaAbierta::subir(size_t posicion) {
+  const Entrada entrada = monticulo_[posicion];
+  while (posicion > 0) {
+    const size_t padre = (posicion - 1) / kAridad;
+    if (monticulo_[padre].cota >= entrada.cota) break;
+    monticulo_[posicion] = monticulo_[padre];
+    posicion = padre;
+  }
+  monticulo_[posicion] = entrada;
+}
+
+/**
+ * @brief Método para bajar una entrada hasta restaurar el montículo
+ * @param posicion Posición de la entrada
+ * @return void
+ */
+void ListaAbierta::bajar(size_t posicion) {
+  const size_t tamanio = monticulo_.size();
+  const Entrada entrada = monticulo_[posicion];
+  while (true) {
+    const size_t primero = posicion * kAridad + 1;
+    if (primero >= tamanio) break;
+    const size_t ultimo = min(primero + kAridad, tamanio);
+    size_t mayor = primero;
+    for (size_t hijo = primero + 1; hijo < ultimo; ++hijo) {
+      if (monticulo_[hijo].cota > monticulo_[mayor].cota) mayor = hijo;
+    }
+    if (monticulo_[mayor].cota <= entrada.cota) break;
+    monticulo_[posicion] = monticulo_[mayor];
+    posicion = mayor;
+  }
+  monticulo_[posicion] = entrada;
+}
+
+/**
+ * @brief Método para restaurar el montículo entero en tiempo lineal
+ * @details Baja cada nodo interno, del último al primero. Con menos de dos entradas no
+ * hay nodos internos
+ * @return void
+ */
+void ListaAbierta::reconstruir() {
+  for (size_t i = (monticulo_.size() + kAridad - 2) / kAridad; i-- > 0;) {
+    bajar(i);
+  }
+}
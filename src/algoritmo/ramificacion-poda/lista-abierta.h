@@ -0,0 +1,71 @@
+/**
+ * @class Clase para representar la lista de nodos abiertos de la Ramificación y Poda
+ * @details Los nodos se guardan en un almacén con ranuras de tamaño fijo (la selección
+ * ocupa m enteros contiguos) y el montículo 4-ario solo mueve entradas pequeñas
+ * (cota e índice de ranura). Las ranuras liberadas se reutilizan
+ */
+
+#ifndef LISTA_ABIERTA_H
+#define LISTA_ABIERTA_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// Estructura para representar un nodo en el árbol de búsqueda
+struct Nodo {
+  vector<int> seleccion;          // Puntos seleccionados
+  double valor;                   // Valor objetivo actual
+  double cota;                    // Cota superior
+  int nivel;                      // Nivel en el árbol (número de puntos seleccionados)
+  
+  Nodo() : valor(0.0), cota(0.0), nivel(0) {}
+  Nodo(vector<int> s, double v, double c, int n) 
+    : seleccion(move(s)), valor(v), cota(c), nivel(n) {}
+};
+
+class ListaAbierta {
+  public:
+    // Constructor por defecto
+    ListaAbierta() {}
+
+    // Métodos de la clase
+    void reiniciar(int maxNivel);
+    void insertar(const vector<int>& seleccion, double valor, double cota, int nivel);
+    void insertar(const vector<int>& seleccion, int punto, double valor, double cota, int nivel);
+    void extraer(Nodo& nodo);
+    size_t podar(double umbral);
+    void serializar(vector<char>& salida) const;
+    bool cargar(const vector<char>& datos, int numPuntos, int maxNivel);
+
+    // Getters
+    inline bool vacia() const { return monticulo_.empty(); }
+    inline size_t getTamanio() const { return monticulo_.size(); }
+    inline double getMaximaCota() const { return monticulo_.front().cota; }
+    size_t getBytes() const;
+
+  private:
+    static constexpr size_t kAridad = 4; // Hijos por nodo del montículo
+
+    // Entrada del montículo: la clave se guarda junto al índice para no tocar el almacén
+    struct Entrada {
+      double cota;
+      uint32_t ranura;
+    };
+
+    uint32_t reservarRanura(double valor, int nivel);
+    void subir(size_t posicion);
+    void bajar(size_t posicion);
+    void reconstruir();
+
+    size_t maxNivel_ = 0; // Enteros reservados para la selección de cada ranura
+    vector<Entrada> monticulo_; // Montículo de máximos por cota
+    vector<int> selecciones_; // Selecciones de todas las ranuras, maxNivel_ enteros por ranura
+    vector<double> valores_; // Valor objetivo de cada ranura
+    vector<int> niveles_; // Nivel de cada ranura
+    vector<uint32_t> libres_; // Ranuras que se pueden reutilizar
+};
+
+#endif
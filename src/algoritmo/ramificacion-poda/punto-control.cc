@@ -0,0 +1,208 @@
+#include "punto-control.h"
+#include <cstring> // Para memcmp y memcpy
+#include <fstream> // Para la lectura y escritura del fichero
+#include <iostream> // Para los avisos
+#include <stdexcept> // Para las excepciones
+
+namespace {
+
+const char kMagia[8] = {'M', 'A', 'X', 'D', 'I', 'V', 'R', 'P'};
+const uint32_t kVersion = 2;
+
+/**
+ * @brief Añade al final del búfer los bytes de un vector de enteros
+ */
+void anadir(vector<char>& buffer, const vector<int>& valores) {
+  const char* inicio = reinterpret_cast<const char*>(valores.data());
+  buffer.insert(buffer.end(), inicio, inicio + valores.size() * sizeof(int32_t));
+}
+
+/**
+ * @brief Escribe el búfer en un fichero temporal y lo renombra
+ */
+void escribirFichero(const fs::path& ruta, const vector<char>& datos) {
+  fs::create_directories(ruta.parent_path());
+  fs::path temporal = ruta;
+  temporal += ".tmp";
+  ofstream fichero(temporal, ios::binary | ios::trunc);
+  if (!fichero) {
+    throw runtime_error("No se puede escribir el punto de control " + temporal.string());
+  }
+  fichero.write(datos.data(), datos.size());
+  fichero.close();
+  if (!fichero) {
+    throw runtime_error("Error al escribir el punto de control " + temporal.string());
+  }
+  fs::rename(temporal, ruta);
+}
+
+} // namespace
+
+/**
+ * @brief Función para calcular la huella FNV-1a de 64 bits de un bloque de bytes
+ * @param datos Bytes
+ * @param bytes Número de bytes
+ * @param huella Huella de los bloques anteriores, para encadenar varios bloques
+ * @details No es criptográfica: solo detecta ficheros dañados o de otra instancia
+ * @return uint64_t Huella
+ */
+uint64_t huellaBytes(const void* datos, size_t bytes, uint64_t huella) {
+  const unsigned char* actual = static_cast<const unsigned char*>(datos);
+  for (size_t i = 0; i < bytes; ++i) {
+    huella = (huella ^ actual[i]) * 1099511628211ull;
+  }
+  return huella;
+}
+
+/**
+ * @brief Función para obtener la ruta del punto de control de una búsqueda
+ * @param directorio Directorio de los puntos de control
+ * @param instancia Nombre del fichero de la instancia
+ * @param numPuntosAlejados Tamaño de las soluciones
+ * @param objetivo Nombre de la función objetivo
+ * @param metrica Nombre de la métrica
+ * @return fs::path Ruta del fichero
+ */
+fs::path rutaPuntoControl(const fs::path& directorio, const string& instancia, int numPuntosAlejados, const string& objetivo, const string& metrica) {
+  return directorio / (instancia + ".m" + to_string(numPuntosAlejados) + "." + objetivo + "." + metrica + ".rp");
+}
+
+/**
+ * @brief Función para serializar un punto de control
+ * @param punto Estado de la búsqueda
+ * @return vector<char> Contenido del fichero
+ */
+vector<char> serializarPuntoControl(const PuntoControl& punto) {
+  CabeceraPuntoControl cabecera = {};
+  memcpy(cabecera.magia, kMagia, sizeof(kMagia));
+  cabecera.version = kVersion;
+  cabecera.numPuntosAlejados = punto.numPuntosAlejados;
+  cabecera.numPuntos = punto.numPuntos;
+  cabecera.tamanioNombre = punto.instancia.size();
+  cabecera.numActivos = punto.activos.size();
+  cabecera.huellaInstancia = punto.huellaInstancia;
+  cabecera.nodosGenerados = punto.nodosGenerados;
+  cabecera.nodosPodados = punto.nodosPodados;
+  cabecera.mejorValor = punto.mejorValor;
+
+  vector<char> buffer;
+  buffer.reserve(sizeof(cabecera) + sizeof(double) + punto.instancia.size()
+    + (punto.mejorSeleccion.size() + punto.activos.size()) * sizeof(int32_t) + punto.abiertos.size() + sizeof(uint64_t));
+  const char* bytesCabecera = reinterpret_cast<const char*>(&cabecera);
+  buffer.insert(buffer.end(), bytesCabecera, bytesCabecera + sizeof(cabecera));
+  const char* bytesTiempo = reinterpret_cast<const char*>(&punto.tiempoCPU);
+  buffer.insert(buffer.end(), bytesTiempo, bytesTiempo + sizeof(double));
+  buffer.insert(buffer.end(), punto.instancia.begin(), punto.instancia.end());
+  anadir(buffer, punto.mejorSeleccion);
+  anadir(buffer, punto.activos);
+  buffer.insert(buffer.end(), punto.abiertos.begin(), punto.abiertos.end());
+  const uint64_t suma = huellaBytes(buffer.data(), buffer.size());
+  const char* bytesSuma = reinterpret_cast<const char*>(&suma);
+  buffer.insert(buffer.end(), bytesSuma, bytesSuma + sizeof(suma));
+  return buffer;
+}
+
+/**
+ * @brief Función para leer un punto de control
+ * @param ruta Ruta del fichero
+ * @param punto Estructura donde se carga el estado
+ * @details Se descarta si no existe, si su formato no coincide o si la suma de
+ * comprobación no cuadra. La lista abierta se devuelve sin interpretar; la valida
+ * ListaAbierta::cargar. Que sea de la misma instancia lo comprueba quien reanuda con
+ * huellaInstancia
+ * @return true si el punto de control es válido y se ha cargado
+ */
+bool cargarPuntoControl(const fs::path& ruta, PuntoControl& punto) {
+  error_code error;
+  if (!fs::is_regular_file(ruta, error)) return false;
+  ifstream fichero(ruta, ios::binary);
+  vector<char> datos((istreambuf_iterator<char>(fichero)), istreambuf_iterator<char>());
+  if (datos.size() < sizeof(CabeceraPuntoControl) + sizeof(double) + sizeof(uint64_t)) return false;
+
+  // La suma de comprobación ocupa los últimos bytes y cubre todo lo anterior
+  uint64_t suma;
+  memcpy(&suma, datos.data() + datos.size() - sizeof(suma), sizeof(suma));
+  datos.resize(datos.size() - sizeof(suma));
+  if (huellaBytes(datos.data(), datos.size()) != suma) {
+    cerr << "Aviso: el punto de control " << ruta.string() << " está dañado" << endl;
+    return false;
+  }
+
+  CabeceraPuntoControl cabecera;
+  memcpy(&cabecera, datos.data(), sizeof(cabecera));
+  bool valido = memcmp(cabecera.magia, kMagia, sizeof(kMagia)) == 0
+    && cabecera.version == kVersion
+    && cabecera.numPuntosAlejados > 0
+    && cabecera.numPuntos > 0
+    && cabecera.numActivos <= static_cast<uint64_t>(cabecera.numPuntos);
+  if (!valido) return false;
+  // Con los campos de 32 bits acotados la suma no desborda
+  const uint64_t bytesFijos = sizeof(cabecera) + sizeof(double) + uint64_t(cabecera.tamanioNombre)
+    + (uint64_t(cabecera.numPuntosAlejados) + cabecera.numActivos) * sizeof(int32_t);
+  if (bytesFijos > datos.size()) return false;
+
+  const char* actual = datos.data() + sizeof(cabecera);
+  memcpy(&punto.tiempoCPU, actual, sizeof(double));
+  actual += sizeof(double);
+  punto.instancia.assign(actual, cabecera.tamanioNombre);
+  actual += cabecera.tamanioNombre;
+  punto.mejorSeleccion.resize(cabecera.numPuntosAlejados);
+  memcpy(punto.mejorSeleccion.data(), actual, punto.mejorSeleccion.size() * sizeof(int32_t));
+  actual += punto.mejorSeleccion.size() * sizeof(int32_t);
+  punto.activos.resize(cabecera.numActivos);
+  memcpy(punto.activos.data(), actual, punto.activos.size() * sizeof(int32_t));
+  actual += punto.activos.size() * sizeof(int32_t);
+  punto.abiertos.assign(actual, static_cast<const char*>(datos.data() + datos.size()));
+
+  punto.numPuntos = cabecera.numPuntos;
+  punto.huellaInstancia = cabecera.huellaInstancia;
+  punto.numPuntosAlejados = cabecera.numPuntosAlejados;
+  punto.mejorValor = cabecera.mejorValor;
+  punto.nodosGenerados = cabecera.nodosGenerados;
+  punto.nodosPodados = cabecera.nodosPodados;
+  return true;
+}
+
+/**
+ * @brief Destructor que espera a la escritura en curso
+ */
+EscritorPuntoControl::~EscritorPuntoControl() {
+  esperar();
+}
+
+/**
+ * @brief Método para saber si hay una escritura en curso
+ * @return true si la última escritura no ha terminado
+ */
+bool EscritorPuntoControl::ocupado() const {
+  return escritura_.valid() && escritura_.wait_for(chrono::seconds(0)) != future_status::ready;
+}
+
+/**
+ * @brief Método para escribir un punto de control en segundo plano
+ * @param ruta Ruta del fichero
+ * @param datos Contenido serializado (lo posee la escritura)
+ * @details Se escribe en un fichero temporal que después se renombra, para que una
+ * interrupción nunca deje un punto de control a medias
+ * @return void
+ */
+void EscritorPuntoControl::guardar(const fs::path& ruta, vector<char> datos) {
+  esperar();
+  escritura_ = async(launch::async, [ruta, datos = move(datos)]() {
+    escribirFichero(ruta, datos);
+  });
+}
+
+/**
+ * @brief Método para esperar a la escritura en curso
+ * @details Los errores de escritura no detienen la búsqueda: se avisa y se sigue
+ * @return void
+ */
+void EscritorPuntoControl::esperar() {
+  if (!escritura_.valid()) return;
+  try {
+    escritura_.get();
+  } catch (const exception& e) {
+    cerr << "Aviso: " << e.what() << endl;
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * @brief Funciones para guardar y reanudar el estado de la Ramificación y Poda
+ * @details Formato del fichero (en el orden nativo de la máquina):
+ *  - Cabecera de 64 bytes (CabeceraPuntoControl)
+ *  - Tiempo de búsqueda acumulado (double)
+ *  - Nombre de la instancia (tamanioNombre bytes)
+ *  - Mejor selección (numPuntosAlejados int32) y puntos activos (numActivos int32)
+ *  - Lista abierta serializada (ListaAbierta::serializar)
+ *  - Suma de comprobación (uint64, huellaBytes de todo lo anterior)
+ */
+
+#ifndef PUNTO_CONTROL_H
+#define PUNTO_CONTROL_H
+
+#include <filesystem> // Para la gestión de ficheros
+#include <future> // Para la escritura en segundo plano
+#include <cstdint> // Para los tipos de tamaño fijo
+#include <string>
+#include <vector>
+
+using namespace std;
+namespace fs = filesystem;
+
+// Cabecera del fichero de punto de control
+struct CabeceraPuntoControl {
+  char magia[8]; // Identificador del formato
+  uint32_t version; // Versión del formato
+  int32_t numPuntosAlejados; // Tamaño de las soluciones
+  int64_t numPuntos; // Número de puntos de la instancia
+  uint32_t tamanioNombre; // Bytes del nombre de la instancia
+  uint32_t numActivos; // Número de puntos activos tras la reducción
+  uint64_t huellaInstancia; // Huella de las coordenadas de la instancia
+  uint64_t nodosGenerados; // Nodos generados hasta el punto de control
+  uint64_t nodosPodados; // Nodos podados hasta el punto de control
+  double mejorValor; // Valor de la mejor solución
+};
+
+static_assert(sizeof(CabeceraPuntoControl) == 64, "La cabecera del punto de control debe ocupar 64 bytes");
+
+// Estado de una búsqueda de Ramificación y Poda
+struct PuntoControl {
+  string instancia; // Nombre del fichero de la instancia
+  int64_t numPuntos = 0; // Número de puntos de la instancia
+  uint64_t huellaInstancia = 0; // Huella de las coordenadas de la instancia
+  int numPuntosAlejados = 0; // Tamaño de las soluciones
+  double mejorValor = 0.0; // Valor de la mejor solución
+  vector<int> mejorSeleccion; // Mejor solución (índices 0-based)
+  vector<int> activos; // Puntos activos tras la reducción
+  uint64_t nodosGenerados = 0; // Nodos generados hasta el punto de control
+  uint64_t nodosPodados = 0; // Nodos podados hasta el punto de control
+  double tiempoCPU = 0.0; // Tiempo de búsqueda acumulado
+  vector<char> abiertos; // Lista abierta serializada
+};
+
+uint64_t huellaBytes(const void* datos, size_t bytes, uint64_t huella = 14695981039346656037ull);
+fs::path rutaPuntoControl(const fs::path& directorio, const string& instancia, int numPuntosAlejados, const string& objetivo, const string& metrica);
+vector<char> serializarPuntoControl(const PuntoControl& punto);
+bool cargarPuntoControl(const fs::path& ruta, PuntoControl& punto);
+
+/**
+ * @class Clase para escribir puntos de control en segundo plano
+ * @details Solo hay una escritura en curso: mientras no termine, los nuevos puntos de
+ * control se descartan en lugar de bloquear la búsqueda
+ */
+class EscritorPuntoControl {
+  public:
+    EscritorPuntoControl() {}
+    ~EscritorPuntoControl();
+
+    EscritorPuntoControl(const EscritorPuntoControl&) = delete;
+    EscritorPuntoControl& operator=(const EscritorPuntoControl&) = delete;
+
+    // Métodos de la clase
+    bool ocupado() const;
+    void guardar(const fs::path& ruta, vector<char> datos);
+    void esperar();
+
+  private:
+    future<void> escritura_; // Escritura en curso
+};
+
+#endif
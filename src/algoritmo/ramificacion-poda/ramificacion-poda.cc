@@ -1,37 +1,138 @@
 #include "ramificacion-poda.h"
+#include <cerrno> // Para errno
+#include <cstring> // Para memcpy
+#include <poll.h> // Para esperar mensajes de varios procesos
+#include <signal.h> // Para kill
+
+namespace {
+
+// Mensajes entre el coordinador y los procesos trabajadores
+enum TipoMensaje : uint32_t {
+  kPedir,   // Trabajador -> coordinador: pide un subárbol (nodos generados y podados desde el anterior)
+  kTrabajo, // Coordinador -> trabajador: subárbol a explorar (un nodo)
+  kCota,    // Coordinador -> trabajador: valor de una solución mejor encontrada por otro proceso
+  kMejora,  // Trabajador -> coordinador: solución mejor (valor y selección)
+  kFin,     // Coordinador -> trabajador: no queda trabajo
+  kEncargo  // Coordinador -> trabajador: instancia, configuración y precomputaciones de la búsqueda
+};
+
+/**
+ * @brief Añade al final de un mensaje los bytes de un valor
+ */
+template <typename T>
+void escribirValor(vector<char>& datos, const T& valor) {
+  const char* inicio = reinterpret_cast<const char*>(&valor);
+  datos.insert(datos.end(), inicio, inicio + sizeof(T));
+}
+
+/**
+ * @brief Lee un valor de un mensaje y avanza la posición
+ */
+template <typename T>
+T leerValor(const vector<char>& datos, size_t& posicion) {
+  if (posicion + sizeof(T) > datos.size()) {
+    throw runtime_error("Mensaje demasiado corto");
+  }
+  T valor;
+  memcpy(&valor, datos.data() + posicion, sizeof(T));
+  posicion += sizeof(T);
+  return valor;
+}
+
+/**
+ * @brief Añade al final de un mensaje una selección (tamaño y puntos)
+ */
+void escribirSeleccion(vector<char>& datos, const vector<int>& seleccion) {
+  escribirValor<int32_t>(datos, seleccion.size());
+  for (const auto& v : seleccion) escribirValor<int32_t>(datos, v);
+}
+
+/**
+ * @brief Lee una selección de un mensaje y avanza la posición
+ */
+vector<int> leerSeleccion(const vector<char>& datos, size_t& posicion) {
+  vector<int> seleccion(leerValor<int32_t>(datos, posicion));
+  for (auto& v : seleccion) v = leerValor<int32_t>(datos, posicion);
+  return seleccion;
+}
+
+/**
+ * @brief Bytes reservados por unas listas de vecinos
+ */
+size_t bytesVecinos(const vector<vector<int>>& vecinos) {
+  size_t bytes = vecinos.capacity() * sizeof(vector<int>);
+  for (const auto& lista : vecinos) bytes += lista.capacity() * sizeof(int);
+  return bytes;
+}
+
+} // namespace
 
 /**
  * @brief Método para calcular precomputaciones necesarias para el algoritmo
+ * @details Las distancias de cada punto se calculan fila a fila sin guardar la matriz.
+ * La cota solo recorre los m - 1 primeros vecinos de cada punto (como mucho nivel de ellos
+ * están seleccionados y hacen falta m - nivel - 1 no seleccionados), así que basta una
+ * ordenación parcial de cada fila. Las filas son independientes y se reparten entre los
+ * hilos del grupo, si lo hay; cada hilo escribe solo en las posiciones de sus filas.
+ * Las filas solo se recorren la primera vez o cuando m necesita más vecinos: en las
+ * demás ejecuciones sobre la misma instancia se copian los vecinos ya calculados. Los
+ * vecinos y la caché de distancias se reutilizan según la generación de las distancias
+ * (y el límite de memoria, en la caché), no según su dirección
  * @return void
  */
 void RamificacionPoda::calcularPrecomputaciones() {
   const size_t n = dato_->espacioVectorial.getDimension();
-  distanciasTotal.resize(n, 0.0);
+  const size_t vecinos = min<size_t>(numPuntosAlejados_ - 1, n - 1);
+  if (!cacheDistancias_.vigente(dato_->distancias, limiteMemoriaDistancias_)) {
+    cacheDistancias_.inicializar(dato_->distancias, limiteMemoriaDistancias_);
+  }
   indicesOrdenados.resize(n);
-  
-  // Calcular la distancia total para cada punto
-  for (size_t v = 0; v < n; ++v) {
-    for (size_t u = 0; u < n; ++u) {
-      if (v != u) {
-        double dist = dato_->espacioVectorial[v].calcularDistancia(dato_->espacioVectorial[u]);
-        distanciasTotal[v] += dist;
-      }
+  if (generacionVecinos_ == dato_->distancias.getGeneracion() && vecinosInstancia_.size() == n && n > 0 && vecinosInstancia_[0].size() >= vecinos) {
+    for (size_t v = 0; v < n; ++v) {
+      indicesOrdenados[v].assign(vecinosInstancia_[v].begin(), vecinosInstancia_[v].begin() + vecinos);
     }
-    
-    // Crear índices ordenados por distancia descendente
-    for (size_t u = 0; u < n; ++u) {
-      if (v != u) {
-        indicesOrdenados[v].push_back(u);
+    return;
+  }
+  distanciasTotal.assign(n, 0.0);
+  
+  repartir(n, [&](size_t inicio, size_t fin) {
+    vector<double> fila(n);
+    vector<int> indices;
+    indices.reserve(n - 1);
+    for (size_t v = inicio; v < fin; ++v) {
+      dato_->distancias.fila(v, fila.data());
+
+      // Calcular la distancia total del punto
+      indices.clear();
+      for (size_t u = 0; u < n; ++u) {
+        if (v != u) {
+          distanciasTotal[v] += fila[u];
+          indices.push_back(u);
+        }
       }
+      
+      // Quedarse con los índices más alejados, de mayor a menor distancia
+      partial_sort(indices.begin(), indices.begin() + vecinos, indices.end(),
+        [&fila](int a, int b) { return fila[a] > fila[b]; });
+      indicesOrdenados[v].assign(indices.begin(), indices.begin() + vecinos);
     }
-    
-    // Ordenar índices de mayor a menor distancia
-    sort(indicesOrdenados[v].begin(), indicesOrdenados[v].end(), 
-      [this, v](int a, int b) {
-        double distA = dato_->espacioVectorial[v].calcularDistancia(dato_->espacioVectorial[a]);
-        double distB = dato_->espacioVectorial[v].calcularDistancia(dato_->espacioVectorial[b]);
-        return distA > distB;
-    });
+  });
+  vecinosInstancia_ = indicesOrdenados;
+  generacionVecinos_ = dato_->distancias.getGeneracion();
+}
+
+/**
+ * @brief Método para repartir un rango de filas entre los hilos del grupo
+ * @param numElementos Número de filas
+ * @param tarea Función que procesa las filas [inicio, fin)
+ * @details Sin grupo de hilos, o con un solo hilo, se ejecuta en el hilo actual
+ * @return void
+ */
+void RamificacionPoda::repartir(size_t numElementos, const function<void(size_t, size_t)>& tarea) const {
+  if (hilos_ == nullptr || hilos_->getNumHilos() <= 1) {
+    tarea(0, numElementos);
+  } else {
+    hilos_->paraCada(numElementos, tarea);
   }
 }
 
@@ -40,14 +141,12 @@ void RamificacionPoda::calcularPrecomputaciones() {
  * @param seleccion Conjunto de índices de puntos seleccionados
  * @return Suma de distancias
  */
-double RamificacionPoda::calcularSumaParejas(const set<int>& seleccion) const {
+double RamificacionPoda::calcularSumaParejas(const vector<int>& seleccion) const {
   double suma = 0.0;
   
-  for (auto i = seleccion.begin(); i != seleccion.end(); ++i) {
-    auto j = i;
-    ++j;
-    for (; j != seleccion.end(); ++j) {
-      suma += dato_->espacioVectorial[*i].calcularDistancia(dato_->espacioVectorial[*j]);
+  for (size_t i = 0; i < seleccion.size(); ++i) {
+    for (size_t j = i + 1; j < seleccion.size(); ++j) {
+      suma += distancia(seleccion[i], seleccion[j]);
     }
   }
   
@@ -60,45 +159,219 @@ double RamificacionPoda::calcularSumaParejas(const set<int>& seleccion) const {
  * @param seleccion Conjunto de índices de puntos seleccionados
  * @return Suma de distancias
  */
-double RamificacionPoda::calcularSumaSelVNoSel(int v, const set<int>& seleccion) const {
+double RamificacionPoda::calcularSumaSelVNoSel(int v, const vector<int>& seleccion) const {
   double suma = 0.0;
   
   for (const auto& s : seleccion) {
-    suma += dato_->espacioVectorial[s].calcularDistancia(dato_->espacioVectorial[v]);
+    suma += distancia(s, v);
   }
   
   return suma;
 }
 
+/**
+ * @brief Método para calcular la menor distancia de un punto a los seleccionados
+ * @param v Punto no seleccionado
+ * @param seleccion Puntos seleccionados
+ * @return Menor distancia (infinito si no hay seleccionados)
+ */
+double RamificacionPoda::calcularMinimoSelV(int v, const vector<int>& seleccion) const {
+  double minimo = numeric_limits<double>::infinity();
+  
+  for (const auto& s : seleccion) {
+    minimo = min(minimo, distancia(s, v));
+  }
+  
+  return minimo;
+}
+
+/**
+ * @brief Método para calcular el valor interno de una selección con la función objetivo
+ * @param seleccion Puntos seleccionados
+ * @details Es el valor con el que se poda: suma de parejas en max-sum y max-mean y
+ * mínimo de parejas en max-min
+ * @return Valor de la selección
+ */
+double RamificacionPoda::valorSeleccion(const vector<int>& seleccion) const {
+  auto distancia = [this](int a, int b) { return this->distancia(a, b); };
+  return conObjetivo(objetivo_, [&](auto politica) {
+    politica.preparar(distancia, seleccion);
+    return politica.valor();
+  });
+}
+
 /**
  * @brief Establece una cota inicial basada en una solución heurística algoritmo
  * @return void
  */
 void RamificacionPoda::establecerCotaInicial() {
   const size_t m = numPuntosAlejados_;
-  const size_t n = dato_->espacioVectorial.getDimension();
   
   // Inicializar límite inferior (LB) usando algoritmo
   auto algoritmo = make_unique<Grasp>();
   algoritmo->setDato(*dato_);
   algoritmo->setNumPuntosAlejados(m);
+  algoritmo->setObjetivo(objetivo_);
+  algoritmo->setMedirMemoria(false); // Forma parte de esta ejecución
+  if (semilla_) algoritmo->setSemilla(*semilla_);
   algoritmo->ejecutar();
   
-  // Obtener el resultado del algoritmo
-  EspacioVectorial espacioAlgoritmo = algoritmo->getResultados().back().espacioVectorial;
-  set<int> seleccionAlgoritmo;
+  // Obtener el resultado del algoritmo (índices sobre la misma instancia)
+  const Resultado& resultado = algoritmo->getResultados().back();
+  mejorSeleccion_ = resultado.seleccion;
+  mejorValor_ = valorSeleccion(mejorSeleccion_); // En la misma precisión que la búsqueda
+}
+
+/**
+ * @brief Método para recalcular los vecinos más alejados restringidos a unos candidatos
+ * @param candidatos Índices de los puntos que siguen activos
+ * @details Se reparte entre los hilos como calcularPrecomputaciones, por lo que no usa
+ * la caché de distancias (que no admite accesos concurrentes)
+ * @return void
+ */
+void RamificacionPoda::ordenarVecinos(const vector<int>& candidatos) {
+  const size_t vecinos = min<size_t>(numPuntosAlejados_ - 1, candidatos.size() - 1);
+  const size_t n = dato_->espacioVectorial.getDimension();
+  repartir(candidatos.size(), [&](size_t inicio, size_t fin) {
+    vector<double> fila(n);
+    vector<int> indices;
+    indices.reserve(candidatos.size());
+    for (size_t i = inicio; i < fin; ++i) {
+      const int v = candidatos[i];
+      indices.clear();
+      auto rellenar = [&](const auto& distancia) {
+        for (const auto& u : candidatos) {
+          if (u != v) {
+            fila[u] = distancia(v, u);
+            indices.push_back(u);
+          }
+        }
+      };
+      if (dato_->matrizDistancias.vacia()) {
+        dato_->distancias.conNucleo(rellenar);
+      } else {
+        rellenar(dato_->matrizDistancias);
+      }
+      partial_sort(indices.begin(), indices.begin() + vecinos, indices.end(),
+        [&fila](int a, int b) { return fila[a] > fila[b]; });
+      indicesOrdenados[v].assign(indices.begin(), indices.begin() + vecinos);
+    }
+  });
+}
+
+/**
+ * @brief Elimina los puntos que no pueden formar parte de una solución mejor que la actual
+ * @details En una solución S con m puntos cada punto u aporta como mucho la mitad de la
+ * suma de sus m - 1 mayores distancias a otros puntos activos, top(u). Por tanto, cualquier
+ * solución que contenga a v vale como mucho (top(v) + suma de las m - 1 mayores top(u),
+ * u != v) / 2. Si esa cota no supera la mejor solución conocida, v se descarta. Al descartar
+ * puntos las sumas top de los demás bajan, así que se repite hasta que no se elimine ninguno.
+ * Con max-min basta con que la m - 1-ésima mayor distancia de v no supere la mejor
+ * solución. Los vecinos de cada punto quedan restringidos a los puntos activos, lo que
+ * también ajusta la cota de la búsqueda
+ * @return void
+ */
+void RamificacionPoda::reducirInstancia() {
+  const size_t m = numPuntosAlejados_;
+  activos_ = indicesInstancia();
+  if (m < 2 || m > activos_.size()) {
+    return;
+  }
+  
+  while (activos_.size() >= m) {
+    vector<int> supervivientes;
+    if (objetivo_ == TipoObjetivo::Minimo) {
+      // Con max-min v necesita m - 1 compañeros a más distancia que la mejor solución
+      for (const auto& u : activos_) {
+        if (distancia(u, indicesOrdenados[u].back()) > mejorValor_) {
+          supervivientes.push_back(u);
+        }
+      }
+    } else {
+      // Suma de las m - 1 mayores distancias de cada punto activo
+      vector<double> top;
+      top.reserve(activos_.size());
+      for (const auto& u : activos_) {
+        double suma = 0.0;
+        for (const auto& w : indicesOrdenados[u]) {
+          suma += distancia(u, w);
+        }
+        top.push_back(suma);
+      }
+    
+      // Las m mayores sumas bastan para obtener las m - 1 mayores sin contar a v
+      vector<double> mayores = top;
+      partial_sort(mayores.begin(), mayores.begin() + m, mayores.end(), greater<double>());
+      double sumaMayores = 0.0;
+      for (size_t i = 0; i + 1 < m; ++i) {
+        sumaMayores += mayores[i];
+      }
+    
+      for (size_t i = 0; i < activos_.size(); ++i) {
+        // Si v está entre las m - 1 mayores, se sustituye por la m-ésima
+        double resto = sumaMayores;
+        if (top[i] >= mayores[m - 2]) {
+          resto += mayores[m - 1] - top[i];
+        }
+        if (0.5 * (top[i] + resto) > mejorValor_) {
+          supervivientes.push_back(activos_[i]);
+        }
+      }
+    }
+    
+    if (supervivientes.size() == activos_.size()) break;
+    activos_ = supervivientes;
+    if (activos_.size() >= m) {
+      ordenarVecinos(activos_);
+    }
+  }
+  
+  // Con menos de m puntos activos ninguna solución puede mejorar la inicial
+  if (activos_.size() < m) {
+    activos_.clear();
+  }
+}
+
+/**
+ * @brief Método para calcular una cota superior de max-min para un nodo del árbol
+ * @param seleccion Conjunto de puntos ya seleccionados
+ * @param nivel Nivel actual en el árbol
+ * @details Cada uno de los m - nivel puntos que faltan tiene m - nivel - 1 compañeros
+ * nuevos, así que su menor distancia no supera la menor a los seleccionados ni su
+ * (m - nivel - 1)-ésimo vecino no seleccionado. El mínimo de la solución no supera el
+ * (m - nivel)-ésimo mayor de esos valores
+ * @return Cota superior para el nodo
+ */
+double RamificacionPoda::calcularCotaMinimo(const vector<int>& seleccion, int nivel) const {
+  auto seleccionado = [&seleccion](int v) {
+    return find(seleccion.begin(), seleccion.end(), v) != seleccion.end();
+  };
+  const size_t m = numPuntosAlejados_;
+  const double valor = valorSeleccion(seleccion);
+  if (nivel >= m) {
+    return valor;
+  }
   
-  for (size_t i = 0; i < espacioAlgoritmo.getDimension(); ++i) {
-    for (size_t j = 0; j < n; ++j) {
-      if (espacioAlgoritmo[i].getIndice() == dato_->espacioVectorial[j].getIndice()) {
-        seleccionAlgoritmo.insert(j);
+  const size_t restantes = m - nivel;
+  vector<double> zValues;
+  for (const auto& v : activos_) {
+    if (seleccionado(v)) continue;
+    double minimo = calcularMinimoSelV(v, seleccion);
+    size_t count = 0;
+    for (const auto& u : indicesOrdenados[v]) {
+      if (seleccionado(u)) continue;
+      if (++count == restantes - 1) {
+        minimo = min(minimo, distancia(v, u));
         break;
       }
     }
+    zValues.push_back(minimo);
   }
-  
-  mejorValor_ = calcularSumaParejas(seleccionAlgoritmo);
-  mejorSeleccion_ = seleccionAlgoritmo;
+  if (zValues.size() < restantes) {
+    return -numeric_limits<double>::infinity();
+  }
+  nth_element(zValues.begin(), zValues.begin() + restantes - 1, zValues.end(), greater<double>());
+  return min(valor, zValues[restantes - 1]);
 }
 
 /**
@@ -107,8 +380,13 @@ void RamificacionPoda::establecerCotaInicial() {
  * @param nivel Nivel actual en el árbol
  * @return Cota superior para el nodo
  */
-double RamificacionPoda::calcularCotaSuperior(const set<int>& seleccion, int nivel) const {
-  const size_t n = dato_->espacioVectorial.getDimension();
+double RamificacionPoda::calcularCotaSuperior(const vector<int>& seleccion, int nivel) const {
+  if (objetivo_ == TipoObjetivo::Minimo) {
+    return calcularCotaMinimo(seleccion, nivel);
+  }
+  auto seleccionado = [&seleccion](int v) {
+    return find(seleccion.begin(), seleccion.end(), v) != seleccion.end();
+  };
   const size_t m = numPuntosAlejados_;
   
   // Valor actual de la solución parcial
@@ -122,16 +400,16 @@ double RamificacionPoda::calcularCotaSuperior(const set<int>& seleccion, int niv
   // Calculamos una cota para los puntos que faltan por seleccionar
   vector<pair<double, int>> zValues;
   
-  for (size_t v = 0; v < n; ++v) {
-    if (seleccion.find(v) == seleccion.end()) {
+  for (const auto& v : activos_) {
+    if (!seleccionado(v)) {
       double zSelV = calcularSumaSelVNoSel(v, seleccion);
       
       // Calculamos un estimado para las distancias entre v y otros puntos no seleccionados
       double sumUnsel = 0.0;
       int count = 0;
       for (const auto& u : indicesOrdenados[v]) {
-        if (seleccion.find(u) == seleccion.end() && count < m - nivel - 1) {
-          sumUnsel += dato_->espacioVectorial[v].calcularDistancia(dato_->espacioVectorial[u]);
+        if (!seleccionado(u) && count < m - nivel - 1) {
+          sumUnsel += distancia(v, u);
           count++;
         }
       }
@@ -156,88 +434,718 @@ double RamificacionPoda::calcularCotaSuperior(const set<int>& seleccion, int niv
 }
 
 /**
- * @brief Implementación del algoritmo con cola de prioridad (enfoque best-first)
+ * @brief Método para expandir un lote de nodos y evaluar las cotas de todos sus hijos
+ * @param lote Nodos a expandir (no completos y con cota mayor que la mejor solución)
+ * @param numLote Número de nodos del lote que se usan
+ * @details Para cada padre con selección S se calculan una sola vez, en vectores contiguos
+ * sobre los candidatos no seleccionados v:
+ *  - zSel[v]: suma de distancias de v a S (max-sum) o la menor de ellas (max-min)
+ *  - suma[v], ultimo[v] y siguiente[v]: suma de las k primeras distancias de v a vecinos
+ *    no seleccionados (k = m - |S| - 2), la k-ésima y la del vecino k + 1
+ * Con ellos la cota de cada hijo S + {w} se obtiene en O(candidatos) sin copiar conjuntos.
+ * En max-sum el valor del hijo es valor(S) + zSel[w], la parte seleccionada de cada v suma
+ * d(v, w), y si w era uno de los k primeros vecinos de v se sustituye por el vecino k + 1.
+ * En max-min cada v que falta por añadir tiene k compañeros nuevos además de w, así que su
+ * menor distancia es como mucho min(zSel[v], d(v, w), k-ésimo vecino sin contar w), y el
+ * mínimo de la solución no supera el (k + 1)-ésimo mayor de esos valores. Son las mismas
+ * cotas que calcularCotaSuperior. Los hijos prometedores se insertan en la lista abierta
  * @return void
  */
-void RamificacionPoda::ejecutarConPrioridad() {
-  auto start = chrono::high_resolution_clock::now();
+template <class Objetivo>
+void RamificacionPoda::expandirLote(const vector<Nodo>& lote, size_t numLote) {
+  const int m = numPuntosAlejados_;
+  vector<int> candidatos;
+  vector<double> zSel, suma, ultimo, siguiente, zV;
+  vector<int> primeros;
+  
+  for (size_t p = 0; p < numLote; ++p) {
+    const Nodo& padre = lote[p];
+    const int nivelHijo = padre.nivel + 1;
+    const int k = max(0, m - nivelHijo - 1); // Vecinos no seleccionados que usa la cota del hijo
+    auto seleccionado = [&padre](int v) {
+      return find(padre.seleccion.begin(), padre.seleccion.end(), v) != padre.seleccion.end();
+    };
+    
+    // Vectores contiguos de los candidatos del padre
+    candidatos.clear();
+    for (const auto& v : activos_) {
+      if (!seleccionado(v)) candidatos.push_back(v);
+    }
+    const size_t numCandidatos = candidatos.size();
+    zSel.assign(numCandidatos, 0.0);
+    suma.assign(numCandidatos, 0.0);
+    ultimo.assign(numCandidatos, 0.0);
+    siguiente.assign(numCandidatos, 0.0);
+    primeros.assign(numCandidatos * max(k, 1), -1);
+    for (size_t c = 0; c < numCandidatos; ++c) {
+      const int v = candidatos[c];
+      if constexpr (Objetivo::kCotaSuma) {
+        zSel[c] = calcularSumaSelVNoSel(v, padre.seleccion);
+      } else {
+        zSel[c] = calcularMinimoSelV(v, padre.seleccion);
+      }
+      int cuenta = 0;
+      for (const auto& u : indicesOrdenados[v]) {
+        if (seleccionado(u)) continue;
+        const double d = distancia(v, u);
+        if (cuenta < k) {
+          suma[c] += d;
+          ultimo[c] = d;
+          primeros[c * k + cuenta] = u;
+        } else {
+          siguiente[c] = d;
+          break;
+        }
+        cuenta++;
+      }
+    }
+    
+    // Evaluar todos los hijos del padre
+    for (size_t h = 0; h < numCandidatos; ++h) {
+      const int w = candidatos[h];
+      const double valorHijo = Objetivo::anadir(padre.valor, zSel[h], zSel[h]); // zSel ya es la suma o el mínimo
+      double cotaHijo = valorHijo;
+      
+      if (nivelHijo < m) {
+        zV.clear();
+        for (size_t c = 0; c < numCandidatos; ++c) {
+          if (c == h) continue;
+          const int v = candidatos[c];
+          const double dvw = distancia(v, w);
+          bool wEntrePrimeros = false;
+          for (int t = 0; t < k; ++t) {
+            if (primeros[c * k + t] == w) {
+              wEntrePrimeros = true;
+              break;
+            }
+          }
+          if constexpr (Objetivo::kCotaSuma) {
+            const double sumaNoSel = wEntrePrimeros ? suma[c] + siguiente[c] - dvw : suma[c];
+            zV.push_back(zSel[c] + dvw + 0.5 * sumaNoSel);
+          } else {
+            double minimo = min(zSel[c], dvw);
+            if (k > 0) minimo = min(minimo, wEntrePrimeros ? siguiente[c] : ultimo[c]);
+            zV.push_back(minimo);
+          }
+        }
+        
+        const size_t restantes = m - nivelHijo;
+        if constexpr (Objetivo::kCotaSuma) {
+          // Sumar los m - nivel mayores valores
+          const size_t usados = min(restantes, zV.size());
+          nth_element(zV.begin(), zV.begin() + usados, zV.end(), greater<double>());
+          for (size_t i = 0; i < usados; ++i) {
+            cotaHijo += zV[i];
+          }
+        } else if (zV.size() < restantes) {
+          // No quedan candidatos suficientes para completar el hijo
+          cotaHijo = -numeric_limits<double>::infinity();
+        } else {
+          // El (m - nivel)-ésimo mayor valor
+          nth_element(zV.begin(), zV.begin() + restantes - 1, zV.end(), greater<double>());
+          cotaHijo = min(cotaHijo, zV[restantes - 1]);
+        }
+      }
+      
+      if (cotaHijo <= mejorValor_) {
+        nodosPodados_++;
+        continue;
+      }
+      nodosGenerados_++;
+      if (nivelHijo == m) {
+        // Solución completa: se actualiza la mejor sin pasar por la lista abierta
+        mejorValor_ = valorHijo;
+        mejorSeleccion_ = padre.seleccion;
+        mejorSeleccion_.push_back(w);
+      } else {
+        abiertos_.insertar(padre.seleccion, w, valorHijo, cotaHijo, nivelHijo);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Método para configurar los puntos de control de la búsqueda
+ * @param directorio Directorio donde se guardan (vacío para desactivarlos)
+ * @param intervaloSegundos Tiempo mínimo entre dos puntos de control
+ * @param reanudar Si se reanuda la búsqueda desde el punto de control que haya
+ * @return void
+ */
+void RamificacionPoda::setPuntoControl(const fs::path& directorio, double intervaloSegundos, bool reanudar) {
+  if (intervaloSegundos <= 0.0) {
+    throw invalid_argument("El intervalo entre puntos de control debe ser mayor que cero");
+  }
+  directorioPuntoControl_ = directorio;
+  intervaloPuntoControl_ = intervaloSegundos;
+  reanudar_ = reanudar;
+}
+
+/**
+ * @brief Método para calcular la huella de las coordenadas de la instancia
+ * @details Distingue los puntos de control de instancias distintas con el mismo nombre,
+ * el mismo n y el mismo m
+ * @return uint64_t Huella
+ */
+uint64_t RamificacionPoda::calcularHuellaInstancia() const {
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  uint64_t huella = huellaBytes(nullptr, 0);
+  for (int i = 0; i < espacio.getDimension(); ++i) {
+    huella = huellaBytes(espacio[i].getCoordenadas(), espacio[i].getDimension() * sizeof(double), huella);
+  }
+  return huella;
+}
+
+/**
+ * @brief Método para restaurar el estado de la búsqueda desde su punto de control
+ * @param tiempoPrevio Tiempo de búsqueda ya consumido antes de la interrupción
+ * @details Las precomputaciones no se guardan porque son deterministas; solo se vuelven
+ * a restringir los vecinos a los puntos activos, como hace reducirInstancia. Un punto de
+ * control dañado, de otra instancia (nombre, n o huella de las coordenadas) o de otro
+ * tamaño de solución se ignora
+ * @return true si se ha reanudado
+ */
+bool RamificacionPoda::reanudarBusqueda(double& tiempoPrevio) {
+  if (!reanudar_ || directorioPuntoControl_.empty()) return false;
   const size_t n = dato_->espacioVectorial.getDimension();
   const size_t m = numPuntosAlejados_;
+  const fs::path ruta = rutaPuntoControl(directorioPuntoControl_, dato_->nombreFichero, m, nombreObjetivo(objetivo_), nombreMetrica(dato_->distancias.getMetrica()));
   
-  // Inicializar contadores
-  nodosGenerados_ = 1; // El nodo raíz
-  nodosPodados_ = 0;
-  
-  // Establecer cota inicial con algoritmo
-  establecerCotaInicial();
-  
-  // Cola de prioridad para nodos, ordenados por cota superior
-  priority_queue<Nodo> cola;
+  PuntoControl punto;
+  if (!cargarPuntoControl(ruta, punto)) return false;
+  auto fueraDeRango = [n](int v) { return v < 0 || static_cast<size_t>(v) >= n; };
+  bool valido = punto.instancia == dato_->nombreFichero
+    && static_cast<size_t>(punto.numPuntos) == n
+    && static_cast<size_t>(punto.numPuntosAlejados) == m
+    && punto.huellaInstancia == calcularHuellaInstancia()
+    && none_of(punto.mejorSeleccion.begin(), punto.mejorSeleccion.end(), fueraDeRango)
+    && none_of(punto.activos.begin(), punto.activos.end(), fueraDeRango)
+    && abiertos_.cargar(punto.abiertos, n, m);
+  if (!valido) {
+    cerr << "Aviso: se ignora el punto de control no válido " << ruta.string() << endl;
+    return false;
+  }
   
-  // Crear nodo raíz
-  set<int> seleccionInicial;
-  double valorInicial = 0.0;
-  double cotaInicial = calcularCotaSuperior(seleccionInicial, 0);
-  cola.push(Nodo(seleccionInicial, valorInicial, cotaInicial, 0));
+  mejorValor_ = punto.mejorValor;
+  mejorSeleccion_ = move(punto.mejorSeleccion);
+  activos_ = move(punto.activos);
+  nodosGenerados_ = punto.nodosGenerados;
+  nodosPodados_ = punto.nodosPodados;
+  tiempoPrevio = punto.tiempoCPU;
+  if (activos_.size() >= m && activos_.size() < n) {
+    ordenarVecinos(activos_);
+  }
+  cerr << "Reanudando " << dato_->nombreFichero << " (m = " << m << ") con "
+    << abiertos_.getTamanio() << " nodos abiertos" << endl;
+  return true;
+}
+
+/**
+ * @brief Método para guardar el estado actual de la búsqueda
+ * @param escritor Escritor que hace la escritura en segundo plano
+ * @param tiempoCPU Tiempo de búsqueda acumulado
+ * @details Solo la serialización se hace en el hilo de la búsqueda
+ * @return void
+ */
+void RamificacionPoda::guardarPuntoControl(EscritorPuntoControl& escritor, double tiempoCPU) const {
+  PuntoControl punto;
+  punto.instancia = dato_->nombreFichero;
+  punto.numPuntos = dato_->espacioVectorial.getDimension();
+  punto.huellaInstancia = calcularHuellaInstancia();
+  punto.numPuntosAlejados = numPuntosAlejados_;
+  punto.mejorValor = mejorValor_;
+  punto.mejorSeleccion = mejorSeleccion_;
+  punto.activos = activos_;
+  punto.nodosGenerados = nodosGenerados_;
+  punto.nodosPodados = nodosPodados_;
+  punto.tiempoCPU = tiempoCPU;
+  abiertos_.serializar(punto.abiertos);
+  escritor.guardar(rutaPuntoControl(directorioPuntoControl_, punto.instancia, numPuntosAlejados_, nombreObjetivo(objetivo_), nombreMetrica(dato_->distancias.getMetrica())),
+    serializarPuntoControl(punto));
+}
+
+/**
+ * @brief Método para explorar la lista abierta hasta vaciarla
+ * @param escritor Escritor de los puntos de control
+ * @param tiempoPrevio Tiempo de búsqueda consumido antes de esta ejecución
+ * @return void
+ */
+void RamificacionPoda::explorar(EscritorPuntoControl& escritor, double tiempoPrevio) {
+  explorarPorPasos(escritor, tiempoPrevio, 0).completar();
+}
+
+/**
+ * @brief Corrutina que explora la lista abierta hasta vaciarla
+ * @param escritor Escritor de los puntos de control
+ * @param tiempoPrevio Tiempo de búsqueda consumido antes de esta ejecución
+ * @param nodosPorPaso Nodos generados entre dos pausas (0 para no pausar)
+ * @details Se extraen lotes de hasta tamanioLote_ nodos prometedores y se evalúan juntos
+ * todos sus hijos. Cuando mejora la solución se eliminan de una vez de la lista abierta
+ * todos los nodos que ya no pueden superarla. Si hay directorio de puntos de control, el
+ * estado se guarda en segundo plano cada intervaloPuntoControl_ segundos. En un proceso
+ * trabajador las mejoras se envían al coordinador y se atienden las de los demás. Si hay
+ * presupuesto, la búsqueda en un solo proceso se detiene al agotarlo y deja la lista
+ * abierta como estaba. Las pausas se hacen entre lotes, con la lista abierta coherente
+ * @return Tarea<> Exploración pendiente
+ */
+Tarea<> RamificacionPoda::explorarPorPasos(EscritorPuntoControl& escritor, double tiempoPrevio, size_t nodosPorPaso) {
+  const int m = numPuntosAlejados_;
+  auto ultimoPuntoControl = chrono::steady_clock::now();
+  size_t iteraciones = 0;
+  size_t siguientePausa = nodosGenerados_ + nodosPorPaso;
   
-  while (!cola.empty()) {
-    // Extraer nodo con mayor cota superior
-    Nodo nodoActual = cola.top();
-    cola.pop();
+  vector<Nodo> lote(tamanioLote_);
+  const bool conPresupuesto = canal_ == nullptr && (tiempoMaximo_ > 0.0 || nodosMaximos_ > 0);
+  while (!abiertos_.vacia()) {
+    if (conPresupuesto && nodosMaximos_ > 0 && nodosGenerados_ >= nodosMaximos_) {
+      interrumpida_ = true;
+      break;
+    }
+    if (++iteraciones % 64 == 0) {
+      // Presupuesto de tiempo de esta ejecución
+      if (conPresupuesto && tiempoMaximo_ > 0.0
+          && chrono::duration<double>(chrono::high_resolution_clock::now() - inicio_).count() >= tiempoMaximo_) {
+        interrumpida_ = true;
+        break;
+      }
+      
+      // Cotas de los otros procesos (solo en un proceso trabajador)
+      if (canal_ != nullptr && recibirCotas()) {
+        nodosPodados_ += abiertos_.podar(mejorValor_);
+      }
+      
+      // Punto de control periódico (el reloj solo se consulta cada 64 lotes)
+      auto ahora = chrono::steady_clock::now();
+      if (!directorioPuntoControl_.empty() && !escritor.ocupado()
+          && chrono::duration<double>(ahora - ultimoPuntoControl).count() >= intervaloPuntoControl_) {
+        guardarPuntoControl(escritor, tiempoPrevio + chrono::duration<double>(chrono::high_resolution_clock::now() - inicio_).count());
+        ultimoPuntoControl = ahora;
+      }
+    }
     
-    // Si la cota es menor que la mejor solución, podar
-    if (nodoActual.cota <= mejorValor_) {
-      nodosPodados_++;
-      continue;
+    // La cima no puede mejorar la solución: el resto tampoco
+    if (abiertos_.getMaximaCota() <= mejorValor_) {
+      nodosPodados_ += abiertos_.getTamanio();
+      abiertos_.reiniciar(m);
+      break;
+    }
+    
+    // Extraer un lote de nodos con mayor cota superior (reutilizando la memoria del lote)
+    size_t numLote = 0;
+    while (!abiertos_.vacia() && numLote < tamanioLote_ && abiertos_.getMaximaCota() > mejorValor_) {
+      abiertos_.extraer(lote[numLote++]);
     }
     
-    // Si es una solución completa
-    if (nodoActual.nivel == m) {
-      if (nodoActual.valor > mejorValor_) {
-        mejorValor_ = nodoActual.valor;
-        mejorSeleccion_ = nodoActual.seleccion;
+    // Ramificar - evaluar los hijos de todo el lote e insertar los prometedores
+    const double valorAnterior = mejorValor_;
+    expandir(lote, numLote);
+    maximoAbiertos_ = max(maximoAbiertos_, abiertos_.getTamanio());
+    
+    // Poda en bloque de los nodos que la nueva solución deja sin opciones
+    if (mejorValor_ > valorAnterior) {
+      nodosPodados_ += abiertos_.podar(mejorValor_);
+      if (canal_ != nullptr) {
+        vector<char> mejora;
+        escribirValor(mejora, mejorValor_);
+        escribirSeleccion(mejora, mejorSeleccion_);
+        canal_->enviar(kMejora, mejora);
       }
-      continue;
     }
     
-    // Ramificar - probar con cada punto no seleccionado
-    for (size_t v = 0; v < n; ++v) {
-      if (nodoActual.seleccion.find(v) == nodoActual.seleccion.end()) {
-        // Crear nuevo nodo
-        set<int> nuevaSeleccion = nodoActual.seleccion;
-        nuevaSeleccion.insert(v);
-        
-        // Calcular nuevo valor (distancias entre todos los pares)
-        double nuevoValor = calcularSumaParejas(nuevaSeleccion);
-        
-        // Calcular cota superior
-        double nuevaCota = calcularCotaSuperior(nuevaSeleccion, nodoActual.nivel + 1);
-        
-        // Si la cota es prometedora, añadir a la cola
-        if (nuevaCota > mejorValor_) {
-          cola.push(Nodo(nuevaSeleccion, nuevoValor, nuevaCota, nodoActual.nivel + 1));
-          nodosGenerados_++;
+    // Pausa cada nodosPorPaso nodos generados
+    if (nodosPorPaso > 0 && nodosGenerados_ >= siguientePausa) {
+      siguientePausa = nodosGenerados_ + nodosPorPaso;
+      co_yield Pausa{};
+    }
+  }
+}
+
+/**
+ * @brief Método para limitar la búsqueda de las siguientes ejecuciones
+ * @param tiempoMaximo Segundos de búsqueda (0 sin límite)
+ * @param nodosMaximos Nodos generados (0 sin límite)
+ * @details Al agotarse se devuelve la mejor solución encontrada, que puede no ser
+ * óptima. Solo se aplica a la búsqueda en un proceso
+ * @return void
+ */
+void RamificacionPoda::setPresupuesto(double tiempoMaximo, size_t nodosMaximos) {
+  if (tiempoMaximo < 0.0) {
+    throw invalid_argument("El tiempo máximo no puede ser negativo");
+  }
+  tiempoMaximo_ = tiempoMaximo;
+  nodosMaximos_ = nodosMaximos;
+}
+
+/**
+ * @brief Método para configurar el reparto de la búsqueda entre procesos
+ * @param procesos Número de procesos trabajadores (1 para buscar en el proceso actual)
+ * @param profundidadReparto Nivel de los subárboles que se reparten
+ * @return void
+ */
+void RamificacionPoda::setProcesos(size_t procesos, int profundidadReparto) {
+  if (procesos == 0) {
+    throw invalid_argument("El número de procesos debe ser mayor que cero");
+  }
+  if (profundidadReparto <= 0) {
+    throw invalid_argument("La profundidad de reparto debe ser mayor que cero");
+  }
+  procesos_ = procesos;
+  profundidadReparto_ = profundidadReparto;
+}
+
+/**
+ * @brief Método para repartir la búsqueda entre procesos trabajadores
+ * @details El coordinador expande la lista abierta hasta que todos los nodos tienen
+ * profundidadReparto_ puntos (como mucho m - 1) y pide los trabajadores al servidor de
+ * procesos, que tiene que estar iniciado; cada uno recibe primero el encargo con la
+ * instancia y las precomputaciones. Cada trabajador pide subárboles por su
+ * canal y los explora; las mejoras que encuentra llegan al coordinador, que se queda con
+ * la mejor solución y envía su valor al resto para que poden con él. Los contadores de
+ * nodos de los trabajadores se suman a los del coordinador
+ * @return void
+ */
+void RamificacionPoda::coordinar() {
+  if (!servidorProcesosIniciado()) {
+    throw runtime_error("Para repartir la búsqueda entre procesos hay que llamar a iniciarServidorProcesos al principio del programa");
+  }
+  const int m = numPuntosAlejados_;
+  const int profundidad = max(1, min(profundidadReparto_, m - 1));
+  
+  // Expandir hasta la profundidad de reparto
+  vector<Nodo> pendientes;
+  vector<Nodo> lote(1);
+  while (!abiertos_.vacia()) {
+    abiertos_.extraer(lote[0]);
+    if (lote[0].cota <= mejorValor_) {
+      nodosPodados_++;
+    } else if (lote[0].nivel >= profundidad) {
+      pendientes.push_back(move(lote[0]));
+    } else {
+      const double valorAnterior = mejorValor_;
+      expandir(lote, 1);
+      if (mejorValor_ > valorAnterior) {
+        nodosPodados_ += abiertos_.podar(mejorValor_);
+      }
+    }
+  }
+  if (pendientes.empty()) return;
+  sort(pendientes.begin(), pendientes.end(), [](const Nodo& a, const Nodo& b) { return a.cota > b.cota; });
+  
+  // Lanzar los trabajadores y enviarles el encargo
+  const size_t numProcesos = min(procesos_, pendientes.size());
+  const vector<char> encargo = crearEncargo();
+  vector<Canal> canales;
+  vector<pid_t> procesos;
+  auto terminarTodos = [&procesos]() {
+    for (const auto& pid : procesos) kill(pid, SIGTERM);
+  };
+  try {
+    for (size_t i = 0; i < numProcesos; ++i) {
+      auto trabajador = crearProcesoTrabajador();
+      procesos.push_back(trabajador.second);
+      canales.push_back(move(trabajador.first));
+      canales.back().enviar(kEncargo, encargo);
+    }
+  } catch (...) {
+    terminarTodos();
+    throw;
+  }
+  
+  // Atender a los trabajadores hasta que no quede trabajo
+  size_t siguiente = 0;
+  size_t activos = numProcesos;
+  vector<bool> terminado(numProcesos, false);
+  vector<pollfd> sondeos;
+  uint32_t tipo;
+  vector<char> datos;
+  try {
+    while (activos > 0) {
+      sondeos.clear();
+      for (size_t i = 0; i < numProcesos; ++i) {
+        sondeos.push_back({terminado[i] ? -1 : canales[i].getDescriptor(), POLLIN, 0});
+      }
+      if (poll(sondeos.data(), sondeos.size(), -1) < 0) {
+        if (errno == EINTR) continue;
+        throw runtime_error("Error al esperar a los procesos trabajadores");
+      }
+      for (size_t i = 0; i < numProcesos; ++i) {
+        if (terminado[i] || sondeos[i].revents == 0) continue;
+        if (!canales[i].recibir(tipo, datos)) {
+          throw runtime_error("Un proceso trabajador ha terminado inesperadamente");
+        }
+        size_t posicion = 0;
+        if (tipo == kPedir) {
+          nodosGenerados_ += leerValor<uint64_t>(datos, posicion);
+          nodosPodados_ += leerValor<uint64_t>(datos, posicion);
+          
+          // Siguiente subárbol que todavía puede mejorar la solución
+          while (siguiente < pendientes.size() && pendientes[siguiente].cota <= mejorValor_) {
+            nodosPodados_++;
+            siguiente++;
+          }
+          if (siguiente < pendientes.size()) {
+            const Nodo& nodo = pendientes[siguiente++];
+            vector<char> trabajo;
+            escribirValor(trabajo, nodo.valor);
+            escribirValor(trabajo, nodo.cota);
+            escribirSeleccion(trabajo, nodo.seleccion);
+            canales[i].enviar(kTrabajo, trabajo);
+          } else {
+            canales[i].enviar(kFin);
+            terminado[i] = true;
+            activos--;
+          }
+        } else if (tipo == kMejora) {
+          const double valor = leerValor<double>(datos, posicion);
+          vector<int> seleccion = leerSeleccion(datos, posicion);
+          if (valor > mejorValor_) {
+            mejorValor_ = valor;
+            mejorSeleccion_ = move(seleccion);
+            vector<char> cota;
+            escribirValor(cota, mejorValor_);
+            for (size_t j = 0; j < numProcesos; ++j) {
+              if (j != i && !terminado[j]) canales[j].enviar(kCota, cota);
+            }
+          }
         } else {
-          nodosPodados_++;
+          throw runtime_error("Mensaje desconocido de un proceso trabajador");
         }
       }
     }
+  } catch (...) {
+    terminarTodos();
+    throw;
+  }
+}
+
+/**
+ * @brief Método para preparar el encargo que reciben los procesos trabajadores
+ * @details Lleva las coordenadas de la instancia, la configuración de la búsqueda, los
+ * puntos activos, los vecinos ordenados de cada punto y el valor de la mejor solución
+ * @return vector<char> Mensaje con el encargo
+ */
+vector<char> RamificacionPoda::crearEncargo() const {
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  const int n = espacio.getDimension();
+  const int dimension = n > 0 ? espacio[0].getDimension() : 0;
+  vector<char> encargo;
+  escribirValor<int32_t>(encargo, n);
+  escribirValor<int32_t>(encargo, dimension);
+  escribirValor<uint32_t>(encargo, static_cast<uint32_t>(dato_->distancias.getPrecision()));
+  escribirValor<uint32_t>(encargo, static_cast<uint32_t>(dato_->distancias.getMetrica()));
+  escribirValor<uint32_t>(encargo, static_cast<uint32_t>(objetivo_));
+  escribirValor<int32_t>(encargo, numPuntosAlejados_);
+  escribirValor<uint64_t>(encargo, tamanioLote_);
+  escribirValor<uint64_t>(encargo, limiteMemoriaDistancias_);
+  escribirValor(encargo, mejorValor_);
+  for (int i = 0; i < n; ++i) {
+    const double* coordenadas = espacio[i].getCoordenadas();
+    for (int k = 0; k < dimension; ++k) escribirValor(encargo, coordenadas[k]);
+  }
+  escribirSeleccion(encargo, activos_);
+  for (int v = 0; v < n; ++v) escribirSeleccion(encargo, indicesOrdenados[v]);
+  return encargo;
+}
+
+/**
+ * @brief Método que ejecuta un proceso trabajador creado por el servidor de procesos
+ * @param canal Canal con el coordinador
+ * @details Reconstruye la instancia y la búsqueda a partir del encargo (primer mensaje
+ * del canal) y atiende al coordinador. Las distancias se calculan bajo demanda con la
+ * caché, con el mismo núcleo que la matriz del coordinador
+ * @return Código de salida del proceso
+ */
+int RamificacionPoda::ejecutarTrabajador(Canal& canal) {
+  try {
+    uint32_t tipo;
+    vector<char> datos;
+    if (!canal.recibir(tipo, datos) || tipo != kEncargo) {
+      throw runtime_error("No se ha recibido el encargo");
+    }
+    size_t posicion = 0;
+    Dato dato;
+    dato.numPuntos = leerValor<int32_t>(datos, posicion);
+    dato.tamanio = leerValor<int32_t>(datos, posicion);
+    const auto precision = static_cast<Precision>(leerValor<uint32_t>(datos, posicion));
+    const auto metrica = static_cast<Metrica>(leerValor<uint32_t>(datos, posicion));
+    RamificacionPoda ramificacionPoda;
+    ramificacionPoda.objetivo_ = static_cast<TipoObjetivo>(leerValor<uint32_t>(datos, posicion));
+    ramificacionPoda.numPuntosAlejados_ = leerValor<int32_t>(datos, posicion);
+    ramificacionPoda.tamanioLote_ = leerValor<uint64_t>(datos, posicion);
+    ramificacionPoda.limiteMemoriaDistancias_ = leerValor<uint64_t>(datos, posicion);
+    ramificacionPoda.mejorValor_ = leerValor<double>(datos, posicion);
+    if (dato.numPuntos <= 0 || dato.tamanio <= 0) {
+      throw runtime_error("Encargo sin puntos");
+    }
+    vector<double> coordenadas(dato.tamanio);
+    for (int i = 0; i < dato.numPuntos; ++i) {
+      for (auto& coordenada : coordenadas) coordenada = leerValor<double>(datos, posicion);
+      dato.espacioVectorial.agregarPunto(Punto(i + 1, coordenadas));
+    }
+    dato.distancias = Distancias(dato.espacioVectorial, precision, metrica);
+    ramificacionPoda.activos_ = leerSeleccion(datos, posicion);
+    ramificacionPoda.indicesOrdenados.resize(dato.numPuntos);
+    for (auto& vecinos : ramificacionPoda.indicesOrdenados) vecinos = leerSeleccion(datos, posicion);
+    
+    ramificacionPoda.setDato(dato);
+    ramificacionPoda.cacheDistancias_.inicializar(dato.distancias, ramificacionPoda.limiteMemoriaDistancias_);
+    ramificacionPoda.expandir_ = conObjetivo(ramificacionPoda.objetivo_, [](auto politica) {
+      return &RamificacionPoda::expandirLote<decltype(politica)>;
+    });
+    return ramificacionPoda.trabajar(canal);
+  } catch (const exception& e) {
+    cerr << "Error en el proceso trabajador: " << e.what() << endl;
+    return 1;
   }
+}
+
+/**
+ * @brief Método que ejecuta un proceso trabajador hasta que el coordinador lo despide
+ * @param canal Canal con el coordinador
+ * @details Se ejecuta en el proceso creado por ejecutarTrabajador: no usa grupo de hilos
+ * ni guarda puntos de control
+ * @return Código de salida del proceso
+ */
+int RamificacionPoda::trabajar(Canal& canal) {
+  hilos_ = nullptr;
+  directorioPuntoControl_.clear();
+  canal_ = &canal;
+  nodosGenerados_ = 0;
+  nodosPodados_ = 0;
+  EscritorPuntoControl escritor;
+  uint32_t tipo;
+  vector<char> datos;
   
-  // Construir el resultado final
-  Dato resultado = *dato_;
-  EspacioVectorial subconjunto;
+  try {
+    while (true) {
+      // Pedir trabajo con los contadores del subárbol anterior
+      vector<char> peticion;
+      escribirValor<uint64_t>(peticion, nodosGenerados_);
+      escribirValor<uint64_t>(peticion, nodosPodados_);
+      canal.enviar(kPedir, peticion);
+      nodosGenerados_ = 0;
+      nodosPodados_ = 0;
+      
+      // Esperar la respuesta atendiendo las cotas que lleguen antes
+      do {
+        if (!canal.recibir(tipo, datos)) return 1;
+        if (tipo == kCota) {
+          size_t posicion = 0;
+          mejorValor_ = max(mejorValor_, leerValor<double>(datos, posicion));
+        }
+      } while (tipo == kCota);
+      if (tipo == kFin) return 0;
+      
+      size_t posicion = 0;
+      const double valor = leerValor<double>(datos, posicion);
+      const double cota = leerValor<double>(datos, posicion);
+      vector<int> seleccion = leerSeleccion(datos, posicion);
+      abiertos_.reiniciar(numPuntosAlejados_);
+      abiertos_.insertar(seleccion, valor, cota, seleccion.size());
+      inicio_ = chrono::high_resolution_clock::now();
+      explorar(escritor, 0.0);
+    }
+  } catch (const exception& e) {
+    cerr << "Error en el proceso trabajador: " << e.what() << endl;
+    return 1;
+  }
+}
+
+/**
+ * @brief Método para atender, sin bloquear, las cotas enviadas por el coordinador
+ * @return true si ha mejorado el valor de la mejor solución
+ */
+bool RamificacionPoda::recibirCotas() {
+  const double valorAnterior = mejorValor_;
+  uint32_t tipo;
+  vector<char> datos;
+  while (canal_->hayMensaje()) {
+    if (!canal_->recibir(tipo, datos)) {
+      throw runtime_error("El coordinador ha cerrado el canal");
+    }
+    if (tipo == kCota) {
+      size_t posicion = 0;
+      mejorValor_ = max(mejorValor_, leerValor<double>(datos, posicion));
+    }
+  }
+  return mejorValor_ > valorAnterior;
+}
+
+/**
+ * @brief Implementación del algoritmo con cola de prioridad (enfoque best-first)
+ * @param nodosPorPaso Nodos generados entre dos pausas (0 para no pausar)
+ * @details Tras la cota inicial y la reducción (o la reanudación desde un punto de
+ * control) la lista abierta se explora en este proceso o se reparte entre procesos
+ * trabajadores (sin pausas). El punto de control se borra al terminar la búsqueda; si
+ * la detiene el presupuesto, se guarda para poder reanudarla
+ * @return Tarea<> Búsqueda pendiente
+ */
+Tarea<> RamificacionPoda::ejecutarConPrioridad(size_t nodosPorPaso) {
+  inicio_ = chrono::high_resolution_clock::now();
+  const int m = numPuntosAlejados_;
   
-  for (const auto& indice : mejorSeleccion_) {
-    subconjunto.agregarPunto(dato_->espacioVectorial[indice]);
+  double tiempoPrevio = 0.0;
+  interrumpida_ = false;
+  maximoAbiertos_ = 0;
+  
+  // Expansión instanciada para la función objetivo
+  expandir_ = conObjetivo(objetivo_, [](auto politica) {
+    return &RamificacionPoda::expandirLote<decltype(politica)>;
+  });
+  
+  if (!reanudarBusqueda(tiempoPrevio)) {
+    // Inicializar contadores
+    nodosGenerados_ = 1; // El nodo raíz
+    nodosPodados_ = 0;
+    
+    // Establecer cota inicial con algoritmo
+    establecerCotaInicial();
+    
+    // Eliminar los puntos que no pueden mejorar la cota inicial
+    reducirInstancia();
+    
+    // Lista abierta ordenada por cota superior, con el nodo raíz
+    abiertos_.reiniciar(m);
+    vector<int> seleccionInicial;
+    double cotaInicial = calcularCotaSuperior(seleccionInicial, 0);
+    abiertos_.insertar(seleccionInicial, valorSeleccion(seleccionInicial), cotaInicial, 0);
   }
   
-  resultado.espacioVectorial = subconjunto;
-  resultado.nodosGenerados = nodosGenerados_; // Guardar el número de nodos generados
+  if (procesos_ > 1) {
+    coordinar();
+  } else {
+    EscritorPuntoControl escritor;
+    Tarea<> exploracion = explorarPorPasos(escritor, tiempoPrevio, nodosPorPaso);
+    while (exploracion.reanudar()) {
+      co_yield Pausa{};
+    }
+    
+    if (!directorioPuntoControl_.empty()) {
+      escritor.esperar();
+      if (interrumpida_) {
+        // Búsqueda sin terminar: se guarda su estado para reanudarla
+        guardarPuntoControl(escritor, tiempoPrevio + chrono::duration<double>(chrono::high_resolution_clock::now() - inicio_).count());
+        escritor.esperar();
+      } else {
+        // La búsqueda ha terminado: su punto de control ya no hace falta
+        error_code error;
+        fs::remove(rutaPuntoControl(directorioPuntoControl_, dato_->nombreFichero, m, nombreObjetivo(objetivo_), nombreMetrica(dato_->distancias.getMetrica())), error);
+      }
+    }
+  }
   
   auto end = chrono::high_resolution_clock::now();
-  resultado.tiempoCPU = chrono::duration<double>(end - start).count();
+  double tiempoCPU = tiempoPrevio + chrono::duration<double>(end - inicio_).count();
   
+  // Construir el resultado final
+  Resultado resultado = construirResultado(mejorSeleccion_, tiempoCPU);
+  resultado.nodosGenerados = nodosGenerados_; // Guardar el número de nodos generados
+  resultado.nodosPodados = nodosPodados_;
+  resultado.puntosEliminados = dato_->espacioVectorial.getDimension() - activos_.size();
+  resultado.interrumpido = interrumpida_;
+  resultado.memoriaTablas += cacheDistancias_.getBytes() + distanciasTotal.capacity() * sizeof(double)
+    + bytesVecinos(indicesOrdenados) + bytesVecinos(vecinosInstancia_);
+  resultado.memoriaAbiertos = abiertos_.getBytes();
+  resultado.nodosAbiertosMaximos = maximoAbiertos_;
   resultados_.push_back(resultado);
 }
 
@@ -246,50 +1154,32 @@ void RamificacionPoda::ejecutarConPrioridad() {
  * @return void
  */
 void RamificacionPoda::ejecutar() {
+  ejecutarPorPasos(0).completar();
+}
+
+/**
+ * @brief Corrutina que ejecuta el algoritmo de Ramificación y Poda por pasos
+ * @param nodosPorPaso Nodos generados entre dos pausas (0 para no pausar)
+ * @details Hace lo mismo que ejecutar, pero se pausa tras las precomputaciones y cada
+ * nodosPorPaso nodos generados. El tiempo en pausa no cuenta en el tiempo de CPU ni en el
+ * presupuesto. El resultado se añade a los resultados al terminar; si la tarea se destruye
+ * antes, la búsqueda se cancela sin resultado
+ * @return Tarea<> Ejecución pendiente
+ */
+Tarea<> RamificacionPoda::ejecutarPorPasos(size_t nodosPorPaso) {
+  iniciarMedicionMemoria();
+  
   // Realizar precomputaciones
   calcularPrecomputaciones();
+  if (nodosPorPaso > 0) {
+    co_yield Pausa{};
+  }
   
   // Ejecutar la versión con cola de prioridad (best-first search)
-  ejecutarConPrioridad();
+  Tarea<> busqueda = ejecutarConPrioridad(nodosPorPaso);
+  while (busqueda.reanudar()) {
+    const auto pausa = chrono::high_resolution_clock::now();
+    co_yield Pausa{};
+    inicio_ += chrono::high_resolution_clock::now() - pausa;
+  }
 }
-
-/**
- * @brief Método para mostrar los resultados del algoritmo de Ramificación y Poda
- * @return void
- */
-void RamificacionPoda::mostrarResultados() {
-  static bool cabeceraMostrada = false;
-
-  if (!cabeceraMostrada) {
-    // Cabecera
-    cout << "---------------------------------------------------------------------------------" << endl;
-    cout << left 
-    << setw(20) << "Problema" 
-    << setw(6) << "n" 
-    << setw(6) << "K" 
-    << setw(6) << "m" 
-    << setw(12) << "z"
-    << setw(12) << "Tiempo CPU" 
-    << setw(18) << "Nodos generados" 
-    << setw(12) << "S"
-    << endl;
-    cout << "---------------------------------------------------------------------------------" << endl;
-    cabeceraMostrada = true;
-  }
-
-  // Mostrar los resultados
-  for (auto& resultado : resultados_) {
-    double distancia = calcularDistancia(resultado.espacioVectorial);
-    cout << left 
-    << setw(20) << resultado.nombreFichero
-    << setw(6) << resultado.numPuntos
-    << setw(6) << resultado.tamanio
-    << setw(6) << resultado.espacioVectorial.getDimension()
-    << setw(12) << fixed << setprecision(2) << distancia
-    << setw(12) << fixed << setprecision(5) << resultado.tiempoCPU
-    << setw(18) << resultado.nodosGenerados
-    << setw(0) << resultado.espacioVectorial
-    << endl;
-  }
-  cout << "---------------------------------------------------------------------------------" << endl;
-}
\ No newline at end of file
@@ -7,29 +7,19 @@
 
 #include "../voraz/voraz.h"
 #include "../grasp/grasp.h"
-#include <stack>
-#include <queue>
+#include "../../distancia/cache-distancias.h"
+#include "../../hilos/grupo-hilos.h"
+#include "lista-abierta.h"
+#include "punto-control.h"
+#include "../../canal/canal.h"
+#include "../../servidor-procesos/servidor-procesos.h"
+#include "../../tarea/tarea.h"
 #include <algorithm>
 #include <set>
 #include <vector>
 #include <limits>
 #include <utility>
-
-// Estructura para representar un nodo en el árbol de búsqueda
-struct Nodo {
-  set<int> seleccion;        // Puntos seleccionados
-  double valor;                   // Valor objetivo actual
-  double cota;                    // Cota superior
-  int nivel;                      // Nivel en el árbol (número de puntos seleccionados)
-  
-  Nodo(const set<int>& s, double v, double c, int n) 
-    : seleccion(s), valor(v), cota(c), nivel(n) {}
-  
-  // Operador para la cola de prioridad (ordenar por cota de mayor a menor)
-  bool operator<(const Nodo& otro) const {
-    return cota < otro.cota; // Para que la cola de prioridad ordene por mayor cota
-  }
-};
+#include <optional>
 
 class RamificacionPoda : public Algoritmo {
   public:
@@ -38,29 +28,84 @@ class RamificacionPoda : public Algoritmo {
 
     // Métodos
     void ejecutar() override;
-    void mostrarResultados() override;
+    Tarea<> ejecutarPorPasos(size_t nodosPorPaso);
+    static int ejecutarTrabajador(Canal& canal);
+
+    // Setters
+    inline void setLimiteMemoriaDistancias(const size_t limiteBytes) { limiteMemoriaDistancias_ = limiteBytes; }
+    inline void setGrupoHilos(GrupoHilos* hilos) { hilos_ = hilos; }
+    inline void setTamanioLote(const size_t tamanioLote) { tamanioLote_ = max<size_t>(1, tamanioLote); }
+    void setPuntoControl(const fs::path& directorio, double intervaloSegundos, bool reanudar);
+    void setProcesos(size_t procesos, int profundidadReparto);
+    inline void setSemilla(const optional<uint32_t> semilla) { semilla_ = semilla; }
+    void setPresupuesto(double tiempoMaximo, size_t nodosMaximos);
+    inline string getNombre() const override { return "RamificacionPoda"; }
 
   private:
     // Métodos auxiliares
+    inline double distancia(int i, int j) const {
+      return dato_->matrizDistancias.vacia() ? cacheDistancias_(i, j) : dato_->matrizDistancias(i, j);
+    }
     void calcularPrecomputaciones();
-    double calcularSumaParejas(const set<int>& seleccion) const;
-    double calcularSumaSelVNoSel(int v, const set<int>& seleccion) const;
-    double calcularCotaSuperior(const set<int>& seleccion, int nivel) const;
+    void repartir(size_t numElementos, const function<void(size_t, size_t)>& tarea) const;
+    double calcularSumaParejas(const vector<int>& seleccion) const;
+    double calcularSumaSelVNoSel(int v, const vector<int>& seleccion) const;
+    double calcularMinimoSelV(int v, const vector<int>& seleccion) const;
+    double valorSeleccion(const vector<int>& seleccion) const;
+    double calcularCotaSuperior(const vector<int>& seleccion, int nivel) const;
+    double calcularCotaMinimo(const vector<int>& seleccion, int nivel) const;
     void establecerCotaInicial();
+    void ordenarVecinos(const vector<int>& candidatos);
+    void reducirInstancia();
     
     // Implementaciones de estrategias de poda
-    void ejecutarConPrioridad();
+    Tarea<> ejecutarConPrioridad(size_t nodosPorPaso);
+    template <class Objetivo>
+    void expandirLote(const vector<Nodo>& lote, size_t numLote);
+    inline void expandir(const vector<Nodo>& lote, size_t numLote) { (this->*expandir_)(lote, numLote); }
+    bool reanudarBusqueda(double& tiempoPrevio);
+    uint64_t calcularHuellaInstancia() const;
+    void guardarPuntoControl(EscritorPuntoControl& escritor, double tiempoCPU) const;
+    void explorar(EscritorPuntoControl& escritor, double tiempoPrevio);
+    Tarea<> explorarPorPasos(EscritorPuntoControl& escritor, double tiempoPrevio, size_t nodosPorPaso);
+    
+    // Búsqueda repartida entre procesos
+    void coordinar();
+    vector<char> crearEncargo() const;
+    int trabajar(Canal& canal);
+    bool recibirCotas();
     
     // Atributos para precomputaciones
     vector<double> distanciasTotal;
-    vector<vector<int>> indicesOrdenados;
+    vector<vector<int>> indicesOrdenados; // Los m - 1 puntos más alejados de cada punto, de mayor a menor distancia
+    vector<vector<int>> vecinosInstancia_; // Vecinos más alejados sobre toda la instancia, reutilizados entre ejecuciones
+    uint64_t generacionVecinos_ = 0; // Generación de las distancias de las que se obtuvieron vecinosInstancia_ (0 si no hay)
+    vector<int> activos_; // Puntos que pueden formar parte de una solución mejor que la inicial
+    CacheDistancias cacheDistancias_; // Distancias calculadas bajo demanda si no hay matriz precalculada
+    size_t limiteMemoriaDistancias_ = size_t(256) << 20; // Memoria máxima de la caché de distancias
+    GrupoHilos* hilos_ = nullptr; // Hilos para las precomputaciones (nullptr para hacerlas en serie)
+    size_t tamanioLote_ = 8; // Nodos que se expanden juntos en cada iteración
+    ListaAbierta abiertos_; // Nodos pendientes de expandir
+    void (RamificacionPoda::*expandir_)(const vector<Nodo>&, size_t) = nullptr; // expandirLote de la función objetivo
+    fs::path directorioPuntoControl_; // Directorio de los puntos de control (vacío para no guardarlos)
+    double intervaloPuntoControl_ = 60.0; // Segundos entre puntos de control
+    bool reanudar_ = false; // Si se reanuda la búsqueda desde su punto de control
+    size_t procesos_ = 1; // Procesos trabajadores (1 para buscar en el proceso actual)
+    int profundidadReparto_ = 2; // Nivel de los subárboles que se reparten entre los procesos
+    Canal* canal_ = nullptr; // Canal con el coordinador (solo en los procesos trabajadores)
+    optional<uint32_t> semilla_; // Semilla del GRASP de la cota inicial (aleatoria si no hay)
+    double tiempoMaximo_ = 0.0; // Segundos de búsqueda antes de detenerla (0 sin límite)
+    size_t nodosMaximos_ = 0; // Nodos generados antes de detener la búsqueda (0 sin límite)
+    bool interrumpida_ = false; // Si el presupuesto ha detenido la búsqueda
+    chrono::high_resolution_clock::time_point inicio_; // Inicio de la búsqueda, retrasado lo que dura cada pausa
     
     // Contadores para estadísticas
     size_t nodosGenerados_;
     size_t nodosPodados_;
+    size_t maximoAbiertos_ = 0; // Máximo de nodos a la vez en la lista abierta (solo en este proceso)
     
     // Mejor solución encontrada
-    set<int> mejorSeleccion_;
+    vector<int> mejorSeleccion_;
     double mejorValor_;
 };
 
@@ -2,92 +2,111 @@
 
 /**
  * @brief Método para calcular el punto más alejado del centro de gravedad
- * @param espacio Espacio vectorial
+ * @param candidatos Índices de los puntos aún no seleccionados
  * @param centroGravedad Centro de gravedad
- * @return Punto más alejado del centro de gravedad
+ * @return Posición en candidatos del punto más alejado del centro de gravedad
  */
-Punto* Voraz::puntoMasAlejado(EspacioVectorial& espacio, const Punto& centroGravedad) const {
+size_t Voraz::puntoMasAlejado(const vector<int>& candidatos, const Punto& centroGravedad) const {
   double maxDistancia = -1;
-  Punto* puntoMasAlejado = nullptr;
+  size_t puntoMasAlejado = 0;
 
-  for (size_t i = 0; i < espacio.getDimension(); ++i) {
-    double distancia = espacio[i].calcularDistancia(centroGravedad);
-    if (distancia > maxDistancia) {
-      maxDistancia = distancia;
-      puntoMasAlejado = &espacio[i];
+  dato_->distancias.conNucleo([&](const auto& distancias) {
+    for (size_t i = 0; i < candidatos.size(); ++i) {
+      double distancia = distancias(candidatos[i], centroGravedad);
+      if (distancia > maxDistancia) {
+        maxDistancia = distancia;
+        puntoMasAlejado = i;
+      }
     }
-  }
+  });
   return puntoMasAlejado;
 }
 
 /**
- * @brief Método para ejecutar el algoritmo Voraz
+ * @brief Método para construir la selección según la función objetivo
+ * @param candidatos Índices de los puntos aún no seleccionados
+ * @param subconjunto Selección que se construye
+ * @details El primer punto es el más alejado del centro de gravedad. Si el valor interno
+ * es la suma de parejas (max-sum y max-mean) se sigue añadiendo el punto más alejado del
+ * centro de gravedad de la selección. Si no, se añade el candidato con mejor valor según
+ * la política, a partir de la suma y del mínimo de sus distancias a la selección, que se
+ * actualizan con cada punto añadido (en empate, el de mayor mínimo)
+ * @return void
  */
-void Voraz::ejecutar() {
-  auto start = chrono::high_resolution_clock::now();
-  Dato resultado = *dato_;
-  EspacioVectorial subconjunto;
+template <class Objetivo>
+void Voraz::construir(vector<int>& candidatos, vector<int>& subconjunto) const {
+  const EspacioVectorial& espacio = dato_->espacioVectorial;
+  const size_t m = static_cast<size_t>(numPuntosAlejados_);
 
   // Obtengo el centro de gravedad
-  Punto centroGravedad = dato_->espacioVectorial.calcularCentroGravedad();
+  Punto centroGravedad = espacio.calcularCentroGravedad();
 
-  do {
-    // Calculo el punto más alejado del centro de gravedad
-    Punto* puntoMasAlejado = this->puntoMasAlejado(resultado.espacioVectorial, centroGravedad);
+  if constexpr (Objetivo::kCotaSuma) {
+    do {
+      // Calculo el punto más alejado del centro de gravedad
+      size_t puntoMasAlejado = this->puntoMasAlejado(candidatos, centroGravedad);
 
-    // Agrego el punto más alejado al resultado
-    subconjunto.agregarPunto(*puntoMasAlejado);
+      // Agrego el punto más alejado al resultado
+      subconjunto.push_back(candidatos[puntoMasAlejado]);
 
-    // Elimino el punto más alejado del espacio vectorial
-    resultado.espacioVectorial.eliminarPunto(*puntoMasAlejado);
+      // Elimino el punto más alejado de los candidatos
+      candidatos.erase(candidatos.begin() + puntoMasAlejado);
 
-    // Calculo el nuevo centro de gravedad
-    centroGravedad = subconjunto.calcularCentroGravedad();
+      // Calculo el nuevo centro de gravedad
+      centroGravedad = espacio.calcularCentroGravedad(subconjunto);
 
-  } while (subconjunto.getDimension() != numPuntosAlejados_);
-  auto end = chrono::high_resolution_clock::now();
-  resultado.tiempoCPU = chrono::duration<double>(end - start).count(); // Tiempo en segundos
+    } while (subconjunto.size() != m);
+  } else {
+    size_t elegido = puntoMasAlejado(candidatos, centroGravedad);
+    vector<double> sumas(candidatos.size(), 0.0);
+    vector<double> minimos(candidatos.size(), numeric_limits<double>::infinity());
+    double valor = Objetivo::inicial();
+    dato_->distancias.conNucleo([&](const auto& distancias) {
+      while (true) {
+        // Agrego el candidato elegido y lo elimino de los candidatos
+        const int punto = candidatos[elegido];
+        valor = Objetivo::anadir(valor, sumas[elegido], minimos[elegido]);
+        subconjunto.push_back(punto);
+        candidatos.erase(candidatos.begin() + elegido);
+        sumas.erase(sumas.begin() + elegido);
+        minimos.erase(minimos.begin() + elegido);
+        if (subconjunto.size() == m) break;
 
-  resultado.espacioVectorial = subconjunto;
-  // Agrego el resultado al vector de resultados
-  resultados_.push_back(resultado);
+        // Actualizo las distancias a la selección y elijo el siguiente
+        double mejorValor = -numeric_limits<double>::infinity();
+        double mejorMinimo = -numeric_limits<double>::infinity();
+        for (size_t i = 0; i < candidatos.size(); ++i) {
+          const double distancia = distancias(candidatos[i], punto);
+          sumas[i] += distancia;
+          minimos[i] = min(minimos[i], distancia);
+          const double valorCandidato = Objetivo::anadir(valor, sumas[i], minimos[i]);
+          if (valorCandidato > mejorValor || (valorCandidato == mejorValor && minimos[i] > mejorMinimo)) {
+            mejorValor = valorCandidato;
+            mejorMinimo = minimos[i];
+            elegido = i;
+          }
+        }
+      }
+    });
+  }
 }
 
 /**
- * @brief Método para mostrar los resultados del algoritmo Voraz
- * @return void
+ * @brief Método para ejecutar el algoritmo Voraz
+ * @details Trabaja con índices sobre la instancia compartida, sin copiar los puntos. La
+ * construcción se instancia para la función objetivo
  */
-void Voraz::mostrarResultados() {
-  static bool cabeceraMostrada = false;
-
-  if (!cabeceraMostrada) {
-    // Cabecera
-    cout << "------------------------------------------------------------------" << endl;
-    cout << left 
-    << setw(20) << "Problema" 
-    << setw(6) << "n" 
-    << setw(6) << "K" 
-    << setw(6) << "m" 
-    << setw(12) << "z"
-    << setw(12) << "Tiempo CPU" 
-    << setw(12) << "S"
-    << endl;
-    cout << "------------------------------------------------------------------" << endl;
-    cabeceraMostrada = true;
-  }
+void Voraz::ejecutar() {
+  iniciarMedicionMemoria();
+  auto start = chrono::high_resolution_clock::now();
+  vector<int> candidatos = indicesInstancia();
+  vector<int> subconjunto;
+  conObjetivo(objetivo_, [&](auto politica) {
+    construir<decltype(politica)>(candidatos, subconjunto);
+  });
+  auto end = chrono::high_resolution_clock::now();
+  double tiempoCPU = chrono::duration<double>(end - start).count(); // Tiempo en segundos
 
-  // Muestro los resultados
-  for (auto& resultado : resultados_) {
-    double distancia = calcularDistancia(resultado.espacioVectorial);
-    cout << left 
-    << setw(20) << resultado.nombreFichero
-    << setw(6) << resultado.numPuntos
-    << setw(6) << resultado.tamanio
-    << setw(6) << resultado.espacioVectorial.getDimension()
-    << setw(12) << fixed << setprecision(2) << distancia
-    << setw(12) << fixed << setprecision(5) << resultado.tiempoCPU
-    << setw(0) << resultado.espacioVectorial
-    << endl;
-  }
-  cout << "------------------------------------------------------------------" << endl;
-}
\ No newline at end of file
+  // Agrego el resultado al vector de resultados
+  resultados_.push_back(construirResultado(subconjunto, tiempoCPU));
+}
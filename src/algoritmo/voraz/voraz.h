@@ -13,10 +13,12 @@ class Voraz : public Algoritmo {
 
     // Métodos de la clase
     void ejecutar() override;
-    void mostrarResultados() override;
+    inline string getNombre() const override { return "Voraz"; }
 
   private:
-    Punto* puntoMasAlejado(EspacioVectorial& espacio, const Punto& centroGravedad) const;
+    size_t puntoMasAlejado(const vector<int>& candidatos, const Punto& centroGravedad) const;
+    template <class Objetivo>
+    void construir(vector<int>& candidatos, vector<int>& subconjunto) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "cache.h"
+#include <cstring> // Para memcmp y memcpy
+#include <limits> // Para comprobar los tamaños de la cabecera
+#include <fstream> // Para la escritura del fichero
+#include <fcntl.h> // Para open
+#include <sys/mman.h> // Para mmap
+#include <sys/stat.h> // Para fstat
+#include <unistd.h> // Para close
+
+namespace {
+
+const char kMagia[8] = {'M', 'A', 'X', 'D', 'I', 'V', 'B', 'N'};
+const uint32_t kVersion = 3;
+const uint64_t kAlineacion = 64;
+
+/**
+ * @brief Redondea un desplazamiento al siguiente múltiplo de la alineación
+ */
+uint64_t alinear(uint64_t offset) {
+  return (offset + kAlineacion - 1) / kAlineacion * kAlineacion;
+}
+
+/**
+ * @brief Obtiene el tamaño y la fecha de modificación del fichero de texto
+ */
+pair<int64_t, int64_t> huellaFuente(const fs::path& rutaTexto) {
+  int64_t tamanio = fs::file_size(rutaTexto);
+  int64_t tiempo = fs::last_write_time(rutaTexto).time_since_epoch().count();
+  return {tamanio, tiempo};
+}
+
+} // namespace
+
+/**
+ * @brief Función para obtener la ruta del fichero de caché de una instancia
+ * @param rutaTexto Ruta del fichero de texto
+ * @details La caché se guarda en el subdirectorio .cache junto a los datos
+ * @return fs::path Ruta del fichero de caché
+ */
+fs::path rutaCache(const fs::path& rutaTexto) {
+  return rutaTexto.parent_path() / ".cache" / (rutaTexto.filename().string() + ".bin");
+}
+
+/**
+ * @brief Función para cargar una instancia desde su caché binaria
+ * @param rutaTexto Ruta del fichero de texto original
+ * @param dato Estructura donde se cargan los datos
+ * @param conDistancias Si se quiere cargar también la matriz de distancias
+ * @param precision Precisión de la matriz de distancias que se quiere cargar
+ * @param metrica Métrica de la matriz de distancias que se quiere cargar
+ * @details El fichero se proyecta en memoria con mmap. Las coordenadas se copian a los
+ * puntos, pero la matriz de distancias se lee en su sitio: la proyección queda abierta
+ * mientras la matriz la use y sus páginas se cargan al leerlas. Se descarta si no existe,
+ * si su formato o sus tamaños no son válidos, si no tiene la matriz pedida en la precisión
+ * y la métrica pedidas o si el fichero de texto ha cambiado desde que se creó
+ * @return true si la caché es válida y se ha cargado
+ */
+bool cargarCache(const fs::path& rutaTexto, Dato& dato, bool conDistancias, Precision precision, Metrica metrica) {
+  error_code error;
+  fs::path ruta = rutaCache(rutaTexto);
+  if (!fs::is_regular_file(ruta, error)) return false;
+
+  int descriptor = open(ruta.c_str(), O_RDONLY);
+  if (descriptor < 0) return false;
+  struct stat estado;
+  if (fstat(descriptor, &estado) != 0 || static_cast<size_t>(estado.st_size) < sizeof(CabeceraCache)) {
+    close(descriptor);
+    return false;
+  }
+  const size_t tamanio = estado.st_size;
+  void* mapa = mmap(nullptr, tamanio, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  close(descriptor);
+  if (mapa == MAP_FAILED) return false;
+  // La proyección se libera cuando deja de usarla la última copia de la matriz
+  shared_ptr<const void> proyeccion(mapa, [tamanio](const void* mapa) {
+    munmap(const_cast<void*>(mapa), tamanio);
+  });
+
+  const char* base = static_cast<const char*>(mapa);
+  CabeceraCache cabecera;
+  memcpy(&cabecera, base, sizeof(cabecera));
+  auto [tamanioFuente, tiempoFuente] = huellaFuente(rutaTexto);
+
+  // Los tamaños se comprueban antes de multiplicarlos para que una cabecera dañada no desborde
+  auto cabe = [tamanio](uint64_t offset, uint64_t elementos, uint64_t bytes) {
+    return offset <= tamanio && (bytes == 0 || elementos <= (tamanio - offset) / bytes);
+  };
+  const uint32_t bytesPedidos = precision == Precision::Simple ? sizeof(float) : sizeof(double);
+  bool valida = memcmp(cabecera.magia, kMagia, sizeof(kMagia)) == 0
+    && cabecera.version == kVersion
+    && cabecera.numPuntos > 0 && cabecera.numPuntos <= numeric_limits<int>::max()
+    && cabecera.dimension > 0 && cabecera.dimension <= numeric_limits<int>::max()
+    && cabecera.tamanioFuente == tamanioFuente && cabecera.tiempoFuente == tiempoFuente
+    && (cabecera.bytesDistancia == 0 || cabecera.bytesDistancia == sizeof(float) || cabecera.bytesDistancia == sizeof(double))
+    && (!conDistancias || (cabecera.bytesDistancia == bytesPedidos && cabecera.metrica == static_cast<uint16_t>(metrica)));
+  if (!valida) return false;
+
+  const uint64_t numCoordenadas = static_cast<uint64_t>(cabecera.numPuntos) * cabecera.dimension;
+  const uint64_t numDistancias = static_cast<uint64_t>(cabecera.numPuntos) * cabecera.numPuntos;
+  if (!cabe(cabecera.offsetCoordenadas, numCoordenadas, sizeof(double))
+      || !cabe(cabecera.offsetDistancias, numDistancias, cabecera.bytesDistancia)
+      || cabecera.offsetCoordenadas % alignof(double) != 0
+      || cabecera.offsetDistancias % alignof(double) != 0) {
+    return false;
+  }
+
+  dato.nombreFichero = rutaTexto.filename().string();
+  dato.numPuntos = static_cast<int>(cabecera.numPuntos);
+  dato.tamanio = static_cast<int>(cabecera.dimension);
+  const double* coordenadas = reinterpret_cast<const double*>(base + cabecera.offsetCoordenadas);
+  for (int i = 0; i < dato.numPuntos; i++) {
+    const double* inicio = coordenadas + static_cast<size_t>(i) * dato.tamanio;
+    dato.espacioVectorial.agregarPunto(Punto(i + 1, vector<double>(inicio, inicio + dato.tamanio)));
+  }
+  if (conDistancias && precision == Precision::Simple) {
+    dato.matrizDistancias.proyectar(reinterpret_cast<const float*>(base + cabecera.offsetDistancias), dato.numPuntos, move(proyeccion));
+  } else if (conDistancias) {
+    dato.matrizDistancias.proyectar(reinterpret_cast<const double*>(base + cabecera.offsetDistancias), dato.numPuntos, move(proyeccion));
+  }
+  return true;
+}
+
+/**
+ * @brief Función para guardar una instancia en su caché binaria
+ * @param rutaTexto Ruta del fichero de texto original
+ * @param dato Datos de la instancia
+ * @details Si la instancia tiene la matriz de distancias calculada, se guarda también. Se escribe en un fichero temporal que después se renombra, para que una
+ * lectura concurrente nunca vea un fichero a medias
+ * @return void
+ */
+void guardarCache(const fs::path& rutaTexto, const Dato& dato) {
+  fs::path ruta = rutaCache(rutaTexto);
+  fs::create_directories(ruta.parent_path());
+
+  const uint64_t n = dato.numPuntos;
+  const uint64_t dimension = dato.tamanio;
+  const bool conDistancias = !dato.matrizDistancias.vacia();
+  auto [tamanioFuente, tiempoFuente] = huellaFuente(rutaTexto);
+
+  CabeceraCache cabecera = {};
+  memcpy(cabecera.magia, kMagia, sizeof(kMagia));
+  cabecera.version = kVersion;
+  cabecera.bytesDistancia = conDistancias ? dato.matrizDistancias.bytesElemento() : 0;
+  cabecera.metrica = static_cast<uint16_t>(dato.distancias.getMetrica());
+  cabecera.numPuntos = n;
+  cabecera.dimension = dimension;
+  cabecera.tamanioFuente = tamanioFuente;
+  cabecera.tiempoFuente = tiempoFuente;
+  cabecera.offsetCoordenadas = alinear(sizeof(CabeceraCache));
+  cabecera.offsetDistancias = conDistancias ? alinear(cabecera.offsetCoordenadas + n * dimension * sizeof(double)) : 0;
+
+  vector<double> coordenadas;
+  coordenadas.reserve(n * dimension);
+  for (uint64_t i = 0; i < n; i++) {
+    for (uint64_t j = 0; j < dimension; j++) {
+      coordenadas.push_back(dato.espacioVectorial[i].getCoordenada(j));
+    }
+  }
+
+  fs::path temporal = ruta;
+  temporal += ".tmp";
+  ofstream fichero(temporal, ios::binary | ios::trunc);
+  if (!fichero) {
+    throw runtime_error("No se puede escribir la caché " + temporal.string());
+  }
+  auto rellenar = [&fichero](uint64_t offset) {
+    while (static_cast<uint64_t>(fichero.tellp()) < offset) fichero.put('\0');
+  };
+  fichero.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+  rellenar(cabecera.offsetCoordenadas);
+  fichero.write(reinterpret_cast<const char*>(coordenadas.data()), coordenadas.size() * sizeof(double));
+  if (conDistancias) {
+    rellenar(cabecera.offsetDistancias);
+    fichero.write(static_cast<const char*>(dato.matrizDistancias.datos()), n * n * cabecera.bytesDistancia);
+  }
+  fichero.close();
+  if (!fichero) {
+    throw runtime_error("Error al escribir la caché " + temporal.string());
+  }
+  fs::rename(temporal, ruta);
+}
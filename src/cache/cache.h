@@ -0,0 +1,39 @@
+/**
+ * @brief Funciones para gestionar la caché binaria de las instancias
+ * @details Formato del fichero (en el orden nativo de la máquina):
+ *  - Cabecera de 64 bytes (CabeceraCache)
+ *  - Coordenadas de los puntos: numPuntos * dimension doubles contiguos, alineados a 64 bytes
+ *  - Matriz de distancias opcional: numPuntos * numPuntos doubles o floats con la métrica de
+ *    la cabecera, alineada a 64 bytes
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "../dato/dato.h"
+#include <filesystem> // Para la gestión de ficheros
+#include <cstdint> // Para los tipos de tamaño fijo
+
+namespace fs = filesystem;
+
+// Cabecera del fichero de caché
+struct CabeceraCache {
+  char magia[8]; // Identificador del formato
+  uint32_t version; // Versión del formato
+  uint16_t bytesDistancia; // Bytes por distancia de la matriz (0 si no hay, 4 float, 8 double)
+  uint16_t metrica; // Métrica de la matriz de distancias
+  int64_t numPuntos; // Número de puntos
+  int64_t dimension; // Dimensión de los puntos
+  int64_t tamanioFuente; // Tamaño en bytes del fichero de texto original
+  int64_t tiempoFuente; // Fecha de modificación del fichero de texto original
+  uint64_t offsetCoordenadas; // Posición de las coordenadas en el fichero
+  uint64_t offsetDistancias; // Posición de la matriz de distancias (0 si no hay)
+};
+
+static_assert(sizeof(CabeceraCache) == 64, "La cabecera de la caché debe ocupar 64 bytes");
+
+fs::path rutaCache(const fs::path& rutaTexto);
+bool cargarCache(const fs::path& rutaTexto, Dato& dato, bool conDistancias, Precision precision, Metrica metrica);
+void guardarCache(const fs::path& rutaTexto, const Dato& dato);
+
+#endif
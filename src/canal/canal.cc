@@ -0,0 +1,191 @@
+#include "canal.h"
+#include <cerrno> // Para errno
+#include <cstring> // Para strerror
+#include <stdexcept> // Para las excepciones
+#include <string>
+#include <poll.h> // Para poll
+#include <sys/socket.h> // Para socketpair, send y el paso de descriptores
+#include <unistd.h> // Para read y close
+
+namespace {
+
+// Cabecera de cada mensaje
+struct CabeceraMensaje {
+  uint32_t tipo; // Tipo del mensaje (lo interpreta quien usa el canal)
+  uint32_t bytes; // Tamaño de los datos que siguen
+};
+
+} // namespace
+
+/**
+ * @brief Operador de asignación por movimiento
+ */
+Canal& Canal::operator=(Canal&& otro) noexcept {
+  if (this != &otro) {
+    cerrar();
+    descriptor_ = exchange(otro.descriptor_, -1);
+  }
+  return *this;
+}
+
+/**
+ * @brief Destructor que cierra el descriptor
+ */
+Canal::~Canal() {
+  cerrar();
+}
+
+/**
+ * @brief Método para crear los dos extremos conectados de un canal
+ * @return pair<Canal, Canal> Extremos del canal
+ */
+pair<Canal, Canal> Canal::crearPar() {
+  int descriptores[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, descriptores) != 0) {
+    throw runtime_error(string("No se puede crear el canal: ") + strerror(errno));
+  }
+  return {Canal(descriptores[0]), Canal(descriptores[1])};
+}
+
+/**
+ * @brief Método para enviar un mensaje completo
+ * @param tipo Tipo del mensaje
+ * @param datos Contenido del mensaje
+ * @details Si el otro extremo se ha cerrado se lanza una excepción en lugar de recibir SIGPIPE
+ * @return void
+ */
+void Canal::enviar(uint32_t tipo, const vector<char>& datos) {
+  CabeceraMensaje cabecera = {tipo, static_cast<uint32_t>(datos.size())};
+  auto escribir = [this](const void* origen, size_t bytes) {
+    const char* actual = static_cast<const char*>(origen);
+    while (bytes > 0) {
+      ssize_t escritos = send(descriptor_, actual, bytes, MSG_NOSIGNAL);
+      if (escritos < 0 && errno == EINTR) continue;
+      if (escritos <= 0) {
+        throw runtime_error(string("Error al enviar por el canal: ") + strerror(errno));
+      }
+      actual += escritos;
+      bytes -= escritos;
+    }
+  };
+  escribir(&cabecera, sizeof(cabecera));
+  escribir(datos.data(), datos.size());
+}
+
+/**
+ * @brief Método para leer exactamente un número de bytes
+ * @param destino Memoria donde se guardan
+ * @param bytes Bytes que se leen
+ * @return true si se han leído todos; false si el otro extremo se ha cerrado
+ */
+bool Canal::leerTodo(void* destino, size_t bytes) {
+  char* actual = static_cast<char*>(destino);
+  while (bytes > 0) {
+    ssize_t leidos = read(descriptor_, actual, bytes);
+    if (leidos < 0 && errno == EINTR) continue;
+    if (leidos < 0) {
+      throw runtime_error(string("Error al recibir por el canal: ") + strerror(errno));
+    }
+    if (leidos == 0) return false;
+    actual += leidos;
+    bytes -= leidos;
+  }
+  return true;
+}
+
+/**
+ * @brief Método para recibir un mensaje completo (bloquea hasta que llega)
+ * @param tipo Tipo del mensaje recibido
+ * @param datos Contenido del mensaje recibido
+ * @return true si se ha recibido; false si el otro extremo se ha cerrado
+ */
+bool Canal::recibir(uint32_t& tipo, vector<char>& datos) {
+  CabeceraMensaje cabecera;
+  if (!leerTodo(&cabecera, sizeof(cabecera))) return false;
+  tipo = cabecera.tipo;
+  datos.resize(cabecera.bytes);
+  if (!leerTodo(datos.data(), datos.size())) {
+    throw runtime_error("Mensaje incompleto en el canal");
+  }
+  return true;
+}
+
+/**
+ * @brief Método para saber, sin bloquear, si hay algo que recibir
+ * @details También devuelve true si el otro extremo se ha cerrado (recibir lo detecta)
+ * @return true si recibir no bloquearía
+ */
+bool Canal::hayMensaje() const {
+  pollfd sondeo = {descriptor_, POLLIN, 0};
+  return poll(&sondeo, 1, 0) > 0;
+}
+
+/**
+ * @brief Método para pasar un extremo de canal al proceso del otro extremo
+ * @param canal Extremo que se envía (se cierra en este proceso)
+ * @details El descriptor viaja como dato auxiliar (SCM_RIGHTS) junto a un byte
+ * @return void
+ */
+void Canal::enviarCanal(Canal& canal) {
+  char byte = 0;
+  iovec bloque = {&byte, 1};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+  msghdr mensaje = {};
+  mensaje.msg_iov = &bloque;
+  mensaje.msg_iovlen = 1;
+  mensaje.msg_control = control;
+  mensaje.msg_controllen = sizeof(control);
+  cmsghdr* auxiliar = CMSG_FIRSTHDR(&mensaje);
+  auxiliar->cmsg_level = SOL_SOCKET;
+  auxiliar->cmsg_type = SCM_RIGHTS;
+  auxiliar->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(auxiliar), &canal.descriptor_, sizeof(int));
+  ssize_t enviados;
+  do {
+    enviados = sendmsg(descriptor_, &mensaje, MSG_NOSIGNAL);
+  } while (enviados < 0 && errno == EINTR);
+  if (enviados != 1) {
+    throw runtime_error(string("Error al enviar un canal: ") + strerror(errno));
+  }
+  canal.cerrar();
+}
+
+/**
+ * @brief Método para recibir un extremo de canal enviado con enviarCanal
+ * @return Canal Extremo recibido
+ */
+Canal Canal::recibirCanal() {
+  char byte;
+  iovec bloque = {&byte, 1};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+  msghdr mensaje = {};
+  mensaje.msg_iov = &bloque;
+  mensaje.msg_iovlen = 1;
+  mensaje.msg_control = control;
+  mensaje.msg_controllen = sizeof(control);
+  ssize_t recibidos;
+  do {
+    recibidos = recvmsg(descriptor_, &mensaje, MSG_CMSG_CLOEXEC);
+  } while (recibidos < 0 && errno == EINTR);
+  if (recibidos < 0) {
+    throw runtime_error(string("Error al recibir un canal: ") + strerror(errno));
+  }
+  cmsghdr* auxiliar = CMSG_FIRSTHDR(&mensaje);
+  if (recibidos != 1 || auxiliar == nullptr || auxiliar->cmsg_type != SCM_RIGHTS) {
+    throw runtime_error("No se ha recibido el canal esperado");
+  }
+  int descriptor;
+  memcpy(&descriptor, CMSG_DATA(auxiliar), sizeof(int));
+  return Canal(descriptor);
+}
+
+/**
+ * @brief Método para cerrar el extremo del canal
+ * @return void
+ */
+void Canal::cerrar() {
+  if (descriptor_ >= 0) {
+    close(descriptor_);
+    descriptor_ = -1;
+  }
+}
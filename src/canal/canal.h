@@ -0,0 +1,45 @@
+/**
+ * @class Clase para representar un extremo de un canal de mensajes entre procesos
+ * @details Los mensajes van sobre un socket local con una cabecera de tipo y tamaño,
+ * así que se reciben siempre completos. El canal posee su descriptor
+ */
+
+#ifndef CANAL_H
+#define CANAL_H
+
+#include <cstdint> // Para los tipos de tamaño fijo
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class Canal {
+  public:
+    // Constructores y destructor
+    explicit Canal(int descriptor = -1) : descriptor_(descriptor) {}
+    Canal(Canal&& otro) noexcept : descriptor_(exchange(otro.descriptor_, -1)) {}
+    Canal& operator=(Canal&& otro) noexcept;
+    ~Canal();
+
+    Canal(const Canal&) = delete;
+    Canal& operator=(const Canal&) = delete;
+
+    // Métodos de la clase
+    static pair<Canal, Canal> crearPar();
+    void enviar(uint32_t tipo, const vector<char>& datos = {});
+    bool recibir(uint32_t& tipo, vector<char>& datos);
+    bool hayMensaje() const;
+    void enviarCanal(Canal& canal);
+    Canal recibirCanal();
+    void cerrar();
+
+    // Getters
+    inline int getDescriptor() const { return descriptor_; }
+
+  private:
+    bool leerTodo(void* destino, size_t bytes);
+
+    int descriptor_; // Descriptor del socket (-1 si está cerrado)
+};
+
+#endif
@@ -6,6 +6,7 @@
 #define DATO_H
 
 #include "../espacio-vectorial/espacio-vectorial.h"
+#include "../distancia/matriz-distancias.h"
 
 struct Dato {
   string nombreFichero; // Nombre del fichero
@@ -13,9 +14,9 @@ struct Dato {
   int numPuntos; // Número de puntos
   int tamanio; // Dimensión de los puntos
 
-  EspacioVectorial espacioVectorial; // Espacio vectorial
-  double tiempoCPU; // Tiempo de CPU
-  size_t nodosGenerados; // Número de nodos generados en el algoritmo de ramificación y poda
+  EspacioVectorial espacioVectorial; // Espacio vectorial (siempre en precisión doble, para evaluar z)
+  Distancias distancias; // Coordenadas contiguas y núcleo de distancia de la instancia
+  MatrizDistancias matrizDistancias; // Matriz de distancias precalculada (vacía si no se ha pedido)
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "cache-distancias.h"
+
+/**
+ * @brief Método para preparar la caché de una instancia
+ * @param distancias Distancias de la instancia (deben seguir vivas mientras se use la caché)
+ * @param limiteBytes Memoria máxima de los bloques
+ * @details Siempre cabe al menos un bloque, aunque el límite sea menor
+ * @return void
+ */
+void CacheDistancias::inicializar(const Distancias& distancias, size_t limiteBytes) {
+  distancias_ = &distancias;
+  generacion_ = distancias.getGeneracion();
+  limiteBytes_ = limiteBytes;
+  simple_ = distancias.getPrecision() == Precision::Simple;
+  const size_t n = distancias.getNumPuntos();
+  numBloques_ = (n + kLado - 1) / kLado;
+  const size_t bytesBloque = kLado * kLado * (simple_ ? sizeof(float) : sizeof(double));
+  const size_t bloquesTriangulo = numBloques_ * (numBloques_ + 1) / 2;
+  maxRanuras_ = max<size_t>(1, min(bloquesTriangulo, limiteBytes / bytesBloque));
+
+  ranuras_.assign(numBloques_ * numBloques_, -1);
+  propietarios_.clear();
+  usados_.clear();
+  dobles_.clear();
+  simples_.clear();
+  manecilla_ = 0;
+}
+
+/**
+ * @brief Método para calcular un bloque y guardarlo en una ranura
+ * @param bloque Índice del bloque (fila de bloques * numBloques + columna de bloques)
+ * @details Mientras haya memoria libre se crea una ranura nueva; si no, se reemplaza
+ * la primera ranura sin usar desde la última pasada del reloj
+ * @return Ranura donde se ha guardado
+ */
+int CacheDistancias::cargarBloque(size_t bloque) const {
+  size_t ranura;
+  if (propietarios_.size() < maxRanuras_) {
+    ranura = propietarios_.size();
+    propietarios_.push_back(bloque);
+    usados_.push_back(0);
+    if (simple_) {
+      simples_.resize(simples_.size() + kLado * kLado);
+    } else {
+      dobles_.resize(dobles_.size() + kLado * kLado);
+    }
+  } else {
+    while (usados_[manecilla_]) {
+      usados_[manecilla_] = 0;
+      manecilla_ = (manecilla_ + 1) % maxRanuras_;
+    }
+    ranura = manecilla_;
+    manecilla_ = (manecilla_ + 1) % maxRanuras_;
+    ranuras_[propietarios_[ranura]] = -1;
+    propietarios_[ranura] = bloque;
+  }
+  ranuras_[bloque] = ranura;
+
+  // Calculo las distancias del bloque fila a fila
+  const int n = distancias_->getNumPuntos();
+  const int filaInicio = bloque / numBloques_ * kLado;
+  const int columnaInicio = bloque % numBloques_ * kLado;
+  const int columnas = min(kLado, n - columnaInicio);
+  for (int f = 0; f < kLado && filaInicio + f < n; ++f) {
+    const size_t offset = ranura * kLado * kLado + f * kLado;
+    if (simple_) {
+      distancias_->tramo(filaInicio + f, columnaInicio, columnas, simples_.data() + offset);
+    } else {
+      distancias_->tramo(filaInicio + f, columnaInicio, columnas, dobles_.data() + offset);
+    }
+  }
+  return ranura;
+}
+
+/**
+ * @brief Método para obtener la memoria ocupada por los bloques y el índice
+ * @return Bytes ocupados
+ */
+size_t CacheDistancias::getBytes() const {
+  return dobles_.capacity() * sizeof(double) + simples_.capacity() * sizeof(float)
+    + ranuras_.capacity() * sizeof(int) + propietarios_.capacity() * sizeof(size_t) + usados_.capacity();
+}
@@ -0,0 +1,62 @@
+/**
+ * @class Clase para cachear distancias por bloques con memoria acotada
+ * @details La matriz se divide en bloques cuadrados de kLado x kLado que se calculan la
+ * primera vez que se consultan. Como la matriz es simétrica solo se guardan los bloques
+ * del triángulo superior. Cuando se alcanza el límite de memoria se reemplaza un bloque
+ * con el algoritmo del reloj. No es seguro usar la misma caché desde varios hilos
+ */
+
+#ifndef CACHE_DISTANCIAS_H
+#define CACHE_DISTANCIAS_H
+
+#include "distancias.h"
+#include <cstdint>
+
+class CacheDistancias {
+  public:
+    // Constructor
+    CacheDistancias() : distancias_(nullptr), generacion_(0), limiteBytes_(0), numBloques_(0), maxRanuras_(0), manecilla_(0) {}
+
+    // Métodos de la clase
+    void inicializar(const Distancias& distancias, size_t limiteBytes);
+    inline double operator()(int i, int j) const {
+      if (i / kLado > j / kLado) swap(i, j);
+      const size_t bloque = static_cast<size_t>(i / kLado) * numBloques_ + j / kLado;
+      int ranura = ranuras_[bloque];
+      if (ranura < 0) {
+        ranura = cargarBloque(bloque);
+      }
+      usados_[ranura] = 1;
+      const size_t k = static_cast<size_t>(ranura) * kLado * kLado + (i % kLado) * kLado + j % kLado;
+      return simple_ ? simples_[k] : dobles_[k];
+    }
+
+    // Getters
+    inline bool inicializada() const { return distancias_ != nullptr; }
+    inline const Distancias* getDistancias() const { return distancias_; }
+    // Si la caché se preparó con estas distancias (misma generación) y este límite
+    inline bool vigente(const Distancias& distancias, size_t limiteBytes) const {
+      return distancias_ == &distancias && generacion_ == distancias.getGeneracion() && limiteBytes_ == limiteBytes;
+    }
+    size_t getBytes() const;
+
+    static constexpr int kLado = 64; // Lado de los bloques
+
+  private:
+    int cargarBloque(size_t bloque) const;
+
+    const Distancias* distancias_; // Distancias de la instancia
+    uint64_t generacion_; // Generación de las distancias con las que se preparó
+    size_t limiteBytes_; // Límite de memoria con el que se preparó
+    bool simple_ = false; // Si los bloques se guardan en precisión simple
+    size_t numBloques_; // Bloques por lado de la matriz
+    size_t maxRanuras_; // Número máximo de bloques en memoria
+    mutable vector<int> ranuras_; // Ranura de cada bloque (-1 si no está en memoria)
+    mutable vector<size_t> propietarios_; // Bloque guardado en cada ranura
+    mutable vector<uint8_t> usados_; // Bit de uso de cada ranura para el algoritmo del reloj
+    mutable vector<double> dobles_; // Ranuras en precisión doble
+    mutable vector<float> simples_; // Ranuras en precisión simple
+    mutable size_t manecilla_; // Posición del reloj
+};
+
+#endif
@@ -0,0 +1,110 @@
+#include "distancias.h"
+#include <atomic> // Para el contador de generaciones
+
+namespace {
+
+atomic<uint64_t> ultimaGeneracion{0}; // Última generación asignada (0 queda para las distancias vacías)
+
+} // namespace
+
+/**
+ * @brief Función para leer una métrica por su nombre
+ * @param nombre Nombre (euclidea, euclidea2, manhattan, chebyshev o coseno)
+ * @return Metrica Métrica
+ */
+Metrica leerMetrica(const string& nombre) {
+  if (nombre == "euclidea") return Metrica::Euclidea;
+  if (nombre == "euclidea2") return Metrica::EuclideaCuadrada;
+  if (nombre == "manhattan") return Metrica::Manhattan;
+  if (nombre == "chebyshev") return Metrica::Chebyshev;
+  if (nombre == "coseno") return Metrica::Coseno;
+  throw invalid_argument("Métrica no válida: " + nombre);
+}
+
+/**
+ * @brief Función para obtener el nombre de una métrica
+ * @param metrica Métrica
+ * @return string Nombre que acepta leerMetrica
+ */
+string nombreMetrica(Metrica metrica) {
+  switch (metrica) {
+    case Metrica::EuclideaCuadrada: return "euclidea2";
+    case Metrica::Manhattan: return "manhattan";
+    case Metrica::Chebyshev: return "chebyshev";
+    case Metrica::Coseno: return "coseno";
+    default: return "euclidea";
+  }
+}
+
+/**
+ * @brief Constructor a partir del espacio vectorial de la instancia
+ * @param espacio Espacio vectorial
+ * @param precision Precisión con la que se guarda la copia contigua de las coordenadas
+ * @param metrica Métrica de las distancias
+ * @details Cada construcción recibe una generación nueva, que identifica el contenido
+ * aunque otras distancias acaben en la misma dirección
+ */
+Distancias::Distancias(const EspacioVectorial& espacio, Precision precision, Metrica metrica)
+  : numPuntos_(espacio.getDimension()),
+    dimension_(numPuntos_ > 0 ? espacio[0].getDimension() : 0),
+    precision_(precision),
+    metrica_(metrica),
+    generacion_(++ultimaGeneracion) {
+  for (int i = 0; i < numPuntos_; ++i) {
+    if (espacio[i].getDimension() != dimension_) {
+      throw invalid_argument("Los puntos deben tener la misma dimensión");
+    }
+  }
+  auto copiar = [&](auto& coordenadas) {
+    coordenadas.reserve(static_cast<size_t>(numPuntos_) * dimension_);
+    for (int i = 0; i < numPuntos_; ++i) {
+      for (int j = 0; j < dimension_; ++j) {
+        coordenadas.push_back(espacio[i].getCoordenada(j));
+      }
+    }
+  };
+  if (precision_ == Precision::Simple) {
+    copiar(coordenadasSimples_);
+  } else {
+    copiar(coordenadas_);
+  }
+}
+
+/**
+ * @brief Método para calcular las distancias de un punto a todos los demás
+ * @param i Índice del punto
+ * @param salida Vector de numPuntos distancias (la del propio punto es 0)
+ * @return void
+ */
+template <class S>
+void Distancias::fila(int i, S* salida) const {
+  tramo(i, 0, numPuntos_, salida);
+}
+
+/**
+ * @brief Método para calcular las distancias de un punto a un tramo de puntos consecutivos
+ * @param i Índice del punto
+ * @param inicio Índice del primer punto del tramo
+ * @param cuenta Número de puntos del tramo
+ * @param salida Vector de cuenta distancias
+ * @return void
+ */
+template <class S>
+void Distancias::tramo(int i, int inicio, int cuenta, S* salida) const {
+  conMetrica(metrica_, [&](auto metrica) {
+    constexpr Metrica M = decltype(metrica)::value;
+    conDimension(dimension_, [&](auto d) {
+      constexpr int D = decltype(d)::value;
+      if (precision_ == Precision::Simple) {
+        distanciasBloque<M, D>(punto<float>(i), punto<float>(inicio), cuenta, dimension_, salida);
+      } else {
+        distanciasBloque<M, D>(punto<double>(i), punto<double>(inicio), cuenta, dimension_, salida);
+      }
+    });
+  });
+}
+
+template void Distancias::fila<double>(int i, double* salida) const;
+template void Distancias::fila<float>(int i, float* salida) const;
+template void Distancias::tramo<double>(int i, int inicio, int cuenta, double* salida) const;
+template void Distancias::tramo<float>(int i, int inicio, int cuenta, float* salida) const;
@@ -0,0 +1,112 @@
+/**
+ * @class Clase para calcular distancias entre los puntos de una instancia
+ * @details Guarda las coordenadas en un bloque contiguo. El núcleo especializado para la
+ * métrica, la dimensión y la precisión de la instancia se elige una vez por bucle, no por
+ * pareja: fila y tramo calculan bloques de distancias y conNucleo pasa a un bucle el
+ * núcleo fijado en compilación, para que el compilador lo expanda en línea
+ */
+
+#ifndef DISTANCIAS_H
+#define DISTANCIAS_H
+
+#include "nucleos.h"
+#include <cstdint> // Para la generación
+#include "../espacio-vectorial/espacio-vectorial.h"
+
+// Precisión de las tablas de distancias: la copia contigua de las coordenadas que usan los
+// núcleos y las distancias precalculadas o cacheadas. Los puntos de la instancia siguen
+// en precisión doble para que el valor z que se informa sea exacto
+enum class Precision { Doble, Simple };
+
+Metrica leerMetrica(const string& nombre);
+string nombreMetrica(Metrica metrica);
+
+/**
+ * @class Núcleo de distancia de una instancia con la métrica M, la dimensión D y la precisión T
+ * @details Objeto ligero que se obtiene con Distancias::conNucleo; solo es válido mientras
+ * vivan las distancias de las que sale
+ */
+template <Metrica M, int D, class T>
+class NucleoDistancias {
+  public:
+    // Constructor
+    NucleoDistancias(const T* coordenadas, int dimension) : coordenadas_(coordenadas), dimension_(dimension) {}
+
+    // Distancia entre dos puntos de la instancia
+    inline double operator()(int i, int j) const { return distancia<M, D>(punto(i), punto(j), dimension_); }
+    // Distancia entre un punto de la instancia y un punto externo
+    inline double operator()(int i, const Punto& otro) const { return distancia<M, D>(punto(i), otro.getCoordenadas(), dimension_); }
+
+  private:
+    inline const T* punto(int i) const {
+      return coordenadas_ + static_cast<size_t>(i) * (D == kDimensionDinamica ? dimension_ : D);
+    }
+
+    const T* coordenadas_; // Coordenadas contiguas de la instancia
+    int dimension_; // Dimensión de los puntos
+};
+
+class Distancias {
+  public:
+    // Constructores
+    Distancias() : numPuntos_(0), dimension_(0), precision_(Precision::Doble), metrica_(Metrica::Euclidea), generacion_(0) {}
+    Distancias(const EspacioVectorial& espacio, Precision precision = Precision::Doble, Metrica metrica = Metrica::Euclidea);
+
+    // Métodos de la clase
+    template <class F> decltype(auto) conNucleo(F&& f) const;
+    template <class S> void fila(int i, S* salida) const;
+    template <class S> void tramo(int i, int inicio, int cuenta, S* salida) const;
+
+    // Getters
+    inline int getNumPuntos() const { return numPuntos_; }
+    inline int getDimension() const { return dimension_; }
+    inline Precision getPrecision() const { return precision_; }
+    inline Metrica getMetrica() const { return metrica_; }
+    inline uint64_t getGeneracion() const { return generacion_; }
+    inline size_t getBytes() const { return coordenadas_.capacity() * sizeof(double) + coordenadasSimples_.capacity() * sizeof(float); }
+
+  private:
+    template <class T> const T* punto(int i) const;
+
+    vector<double> coordenadas_; // Coordenadas de todos los puntos, contiguas (precisión doble)
+    vector<float> coordenadasSimples_; // Coordenadas de todos los puntos, contiguas (precisión simple)
+    int numPuntos_; // Número de puntos
+    int dimension_; // Dimensión de los puntos
+    Precision precision_; // Precisión de la copia de las coordenadas y de las distancias
+    Metrica metrica_; // Métrica de las distancias
+    uint64_t generacion_; // Identificador de estas distancias (distinto en cada construcción, igual en las copias)
+};
+
+/**
+ * @brief Método para obtener las coordenadas de un punto en la precisión T
+ */
+template <class T>
+inline const T* Distancias::punto(int i) const {
+  if constexpr (is_same_v<T, float>) {
+    return coordenadasSimples_.data() + static_cast<size_t>(i) * dimension_;
+  } else {
+    return coordenadas_.data() + static_cast<size_t>(i) * dimension_;
+  }
+}
+
+/**
+ * @brief Método para invocar f con el núcleo especializado de la instancia
+ * @details f recibe un NucleoDistancias con la métrica, la dimensión y la precisión como
+ * constantes de compilación. El bucle que consulta distancias debe ir dentro de f, para
+ * que la elección se haga una vez por bucle. Todas las ramas deben devolver el mismo tipo
+ */
+template <class F>
+inline decltype(auto) Distancias::conNucleo(F&& f) const {
+  return conMetrica(metrica_, [&](auto metrica) -> decltype(auto) {
+    constexpr Metrica M = decltype(metrica)::value;
+    return conDimension(dimension_, [&](auto d) -> decltype(auto) {
+      constexpr int D = decltype(d)::value;
+      if (precision_ == Precision::Simple) {
+        return f(NucleoDistancias<M, D, float>(punto<float>(0), dimension_));
+      }
+      return f(NucleoDistancias<M, D, double>(punto<double>(0), dimension_));
+    });
+  });
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include "matriz-distancias.h"
+
+/**
+ * @brief Método para calcular la matriz completa
+ * @param distancias Distancias de la instancia (determinan también la precisión)
+ * @return void
+ */
+void MatrizDistancias::calcular(const Distancias& distancias) {
+  const int numPuntos = distancias.getNumPuntos();
+  const size_t n = numPuntos;
+  auto rellenar = [&](auto valor) {
+    auto matriz = make_shared<vector<decltype(valor)>>(n * n);
+    for (size_t i = 0; i < n; i++) {
+      distancias.fila(i, matriz->data() + i * n);
+    }
+    proyectar(matriz->data(), numPuntos, matriz);
+  };
+  if (distancias.getPrecision() == Precision::Simple) {
+    rellenar(0.0f);
+  } else {
+    rellenar(0.0);
+  }
+}
+
+/**
+ * @brief Método para usar un bloque de distancias sin copiarlo (por ejemplo, la caché proyectada)
+ * @param datos Distancias fila a fila
+ * @param numPuntos Número de puntos
+ * @param propietario Dueño del bloque, que la matriz mantiene vivo mientras lo usa
+ * @return void
+ */
+template <class T>
+void MatrizDistancias::proyectar(const T* datos, int numPuntos, shared_ptr<const void> propietario) {
+  bloque_ = move(propietario);
+  datos_ = datos;
+  numPuntos_ = numPuntos;
+  precision_ = is_same_v<T, float> ? Precision::Simple : Precision::Doble;
+}
+
+template void MatrizDistancias::proyectar<double>(const double* datos, int numPuntos, shared_ptr<const void> propietario);
+template void MatrizDistancias::proyectar<float>(const float* datos, int numPuntos, shared_ptr<const void> propietario);
@@ -0,0 +1,42 @@
+/**
+ * @class Clase para guardar la matriz de distancias precalculada de una instancia
+ * @details En precisión simple ocupa la mitad de memoria (n² · 4 bytes). La matriz es
+ * inmutable una vez calculada o proyectada: sus copias comparten el mismo bloque, que
+ * puede ser memoria propia o una proyección de la caché binaria que se mantiene abierta
+ * mientras alguna copia la use
+ */
+
+#ifndef MATRIZ_DISTANCIAS_H
+#define MATRIZ_DISTANCIAS_H
+
+#include "distancias.h"
+#include <memory> // Para el bloque compartido
+
+class MatrizDistancias {
+  public:
+    // Constructor
+    MatrizDistancias() : datos_(nullptr), numPuntos_(0), precision_(Precision::Doble) {}
+
+    // Métodos de la clase
+    void calcular(const Distancias& distancias);
+    template <class T> void proyectar(const T* datos, int numPuntos, shared_ptr<const void> propietario);
+    inline double operator()(int i, int j) const {
+      const size_t k = static_cast<size_t>(i) * numPuntos_ + j;
+      return precision_ == Precision::Simple ? static_cast<const float*>(datos_)[k] : static_cast<const double*>(datos_)[k];
+    }
+
+    // Getters
+    inline bool vacia() const { return numPuntos_ == 0; }
+    inline Precision getPrecision() const { return precision_; }
+    inline size_t bytesElemento() const { return precision_ == Precision::Simple ? sizeof(float) : sizeof(double); }
+    inline size_t getBytes() const { return static_cast<size_t>(numPuntos_) * numPuntos_ * bytesElemento(); }
+    inline const void* datos() const { return datos_; }
+
+  private:
+    shared_ptr<const void> bloque_; // Dueño de las distancias (vector propio o proyección de la caché)
+    const void* datos_; // Distancias fila a fila, en la precisión de la matriz
+    int numPuntos_; // Número de puntos (0 si no está calculada)
+    Precision precision_; // Precisión de las distancias
+};
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @brief Núcleos de distancia especializados en tiempo de compilación
+ * @details M es la métrica y D la dimensión de los puntos; D = 0 indica dimensión conocida solo en
+ * ejecución. Con D fijo el compilador desenrolla el bucle y mantiene todo en registros.
+ * Los núcleos aceptan coordenadas float o double y operan en el tipo común de ambas
+ */
+
+#ifndef NUCLEOS_H
+#define NUCLEOS_H
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+using namespace std;
+
+// Dimensión conocida solo en tiempo de ejecución
+constexpr int kDimensionDinamica = 0;
+
+// Medidas de disimilitud entre puntos
+enum class Metrica {
+  Euclidea,         // Raíz de la suma de cuadrados
+  EuclideaCuadrada, // Suma de cuadrados (sin raíz)
+  Manhattan,        // Suma de diferencias absolutas
+  Chebyshev,        // Mayor diferencia absoluta
+  Coseno            // 1 - coseno del ángulo entre los vectores
+};
+
+/**
+ * @brief Distancia con la métrica M entre dos puntos de dimensión D
+ * @details Cada métrica es un único bucle sin ramas sobre las coordenadas, que el
+ * compilador vectoriza con D fijo. En coseno, si un vector es nulo la distancia es 0
+ * si ambos lo son y 1 si no
+ */
+template <Metrica M, int D, class A, class B>
+inline double distancia(const A* a, const B* b, int dimension) {
+  using T = common_type_t<A, B>;
+  const int d = D == kDimensionDinamica ? dimension : D;
+  if constexpr (M == Metrica::Coseno) {
+    T producto = 0, normaA = 0, normaB = 0;
+    for (int i = 0; i < d; ++i) {
+      producto += a[i] * b[i];
+      normaA += a[i] * a[i];
+      normaB += b[i] * b[i];
+    }
+    if (normaA == 0 || normaB == 0) {
+      return normaA == normaB ? 0.0 : 1.0;
+    }
+    return max(0.0, 1.0 - static_cast<double>(producto) / sqrt(static_cast<double>(normaA) * normaB));
+  } else {
+    T acumulado = 0;
+    for (int i = 0; i < d; ++i) {
+      T diferencia = a[i] - b[i];
+      if constexpr (M == Metrica::Manhattan) {
+        acumulado += abs(diferencia);
+      } else if constexpr (M == Metrica::Chebyshev) {
+        acumulado = max(acumulado, abs(diferencia));
+      } else {
+        acumulado += diferencia * diferencia;
+      }
+    }
+    if constexpr (M == Metrica::Euclidea) {
+      return sqrt(acumulado);
+    } else {
+      return acumulado;
+    }
+  }
+}
+
+/**
+ * @brief Distancias con la métrica M de un punto a un bloque de puntos contiguos de dimensión D
+ * @param punto Coordenadas del punto
+ * @param bloque Coordenadas de los puntos del bloque, uno tras otro
+ * @param numPuntos Número de puntos del bloque
+ * @param dimension Dimensión de los puntos (solo se usa si D es dinámica)
+ * @param salida Distancias calculadas
+ */
+template <Metrica M, int D, class T, class S>
+inline void distanciasBloque(const T* punto, const T* bloque, int numPuntos, int dimension, S* salida) {
+  const int d = D == kDimensionDinamica ? dimension : D;
+  for (int j = 0; j < numPuntos; ++j) {
+    salida[j] = distancia<M, D>(punto, bloque + j * d, d);
+  }
+}
+
+/**
+ * @brief Invoca f con la dimensión como constante de compilación
+ * @details Las dimensiones sin especialización usan el núcleo genérico
+ */
+template <class F>
+inline decltype(auto) conDimension(int dimension, F&& f) {
+  switch (dimension) {
+    case 2: return f(integral_constant<int, 2>{});
+    case 3: return f(integral_constant<int, 3>{});
+    case 4: return f(integral_constant<int, 4>{});
+    case 8: return f(integral_constant<int, 8>{});
+    default: return f(integral_constant<int, kDimensionDinamica>{});
+  }
+}
+
+/**
+ * @brief Invoca f con la métrica como constante de compilación
+ */
+template <class F>
+inline decltype(auto) conMetrica(Metrica metrica, F&& f) {
+  switch (metrica) {
+    case Metrica::EuclideaCuadrada: return f(integral_constant<Metrica, Metrica::EuclideaCuadrada>{});
+    case Metrica::Manhattan: return f(integral_constant<Metrica, Metrica::Manhattan>{});
+    case Metrica::Chebyshev: return f(integral_constant<Metrica, Metrica::Chebyshev>{});
+    case Metrica::Coseno: return f(integral_constant<Metrica, Metrica::Coseno>{});
+    default: return f(integral_constant<Metrica, Metrica::Euclidea>{});
+  }
+}
+
+#endif
@@ -18,6 +18,24 @@ Punto EspacioVectorial::calcularCentroGravedad() const {
   return Punto(centroGravedad);
 }
 
+/**
+ * @brief Método para calcular el centro de gravedad de un subconjunto de puntos
+ * @param indices Índices de los puntos del subconjunto
+ * @return Punto centro de gravedad
+ */
+Punto EspacioVectorial::calcularCentroGravedad(const vector<int>& indices) const {
+  vector<double> centroGravedad(espacioVectorial_[0].getDimension(), 0.0);
+  for (const auto& i : indices) {
+    for (size_t j = 0; j < centroGravedad.size(); ++j) {
+      centroGravedad[j] += espacioVectorial_[i].getCoordenada(j);
+    }
+  }
+  for (size_t j = 0; j < centroGravedad.size(); ++j) {
+    centroGravedad[j] /= indices.size();
+  }
+  return Punto(centroGravedad);
+}
+
 /**
  * @brief Método para eliminar un punto del espacio vectorial
  * @param punto Punto a eliminar
@@ -15,6 +15,7 @@ class EspacioVectorial {
     // Métodos de la clase
     inline void agregarPunto(const Punto& punto) { espacioVectorial_.push_back(punto); }
     Punto calcularCentroGravedad() const;
+    Punto calcularCentroGravedad(const vector<int>& indices) const;
     void eliminarPunto(const Punto& punto);
 
     // Getters
@@ -1,153 +1,397 @@
 #include "funciones-main.h"
 
+namespace {
+
+// Opciones de la línea de comandos, una por línea (se añaden al nombre del programa)
+const char* const kUso =
+  " <directorio> [opciones]\n"
+  "  --ventana N                      ficheros precargados mientras se resuelve el actual\n"
+  "  --sin-cache                      no leer ni generar la caché binaria\n"
+  "  --distancias                     precalcular la matriz de distancias\n"
+  "  --precision doble|simple         precisión de las tablas de distancias\n"
+  "  --objetivo suma|minimo|media     función objetivo\n"
+  "  --metrica euclidea|euclidea2|manhattan|chebyshev|coseno\n"
+  "                                   métrica de las distancias\n"
+  "  --memoria-distancias MB          memoria de la caché de distancias de ramificación y poda\n"
+  "  --hilos N                        hilos de las fases paralelas\n"
+  "  --formato tabla|csv|json         formato de los resultados\n"
+  "  --salida fichero                 fichero donde se añaden los resultados\n"
+  "  --puntos-control directorio      directorio de los puntos de control\n"
+  "  --intervalo-puntos-control S     segundos entre puntos de control\n"
+  "  --reanudar                       reanudar desde los puntos de control\n"
+  "  --procesos N                     procesos trabajadores de ramificación y poda\n"
+  "  --profundidad-reparto D          nivel de los subárboles repartidos\n"
+  "  --semilla N                      semilla de GRASP\n"
+  "  --verificar                      verificar los algoritmos en lugar de mostrar el menú\n"
+  "  --referencias fichero            referencias de rendimiento de la verificación\n"
+  "  --tolerancia T                   exceso relativo tolerado sobre las referencias\n"
+  "  --actualizar-referencias         guardar las medidas como nuevas referencias";
+
+} // namespace
+
 /**
- * @brief Función para ordenar los datos
- * @param datos Vector de estructuras Dato con los datos a ordenar
- * @details Datos ordenados por el nombre del fichero
- * @return vector<Dato> Vector de estructuras Dato ordenado
+ * @brief Función para leer las opciones de la línea de comandos
+ * @param argc Número de argumentos
+ * @param argv Argumentos
+ * @details Las opciones admitidas se describen en kUso, que se muestra si falta el directorio
+ * @return Opciones Opciones leídas
  */
-vector<Dato> ordenarDatos(vector<Dato>& datos) {
-  sort(datos.begin(), datos.end(), [](const Dato& a, const Dato& b) {
-    return a.nombreFichero < b.nombreFichero;
-  });
-  return datos;
+Opciones leerOpciones(int argc, char* argv[]) {
+  if (argc < 2) {
+    throw invalid_argument(string("Uso: ") + argv[0] + kUso);
+  }
+  Opciones opciones;
+  opciones.directorio = argv[1];
+  for (int i = 2; i < argc; i++) {
+    string argumento = argv[i];
+    if (argumento == "--ventana" && i + 1 < argc) {
+      int ventana = stoi(argv[++i]);
+      if (ventana <= 0) {
+        throw invalid_argument("La ventana de precarga debe ser mayor que cero");
+      }
+      opciones.ventana = ventana;
+    } else if (argumento == "--formato" && i + 1 < argc) {
+      opciones.formato = argv[++i];
+    } else if (argumento == "--salida" && i + 1 < argc) {
+      opciones.salida = argv[++i];
+    } else if (argumento == "--precision" && i + 1 < argc) {
+      string precision = argv[++i];
+      if (precision == "doble") {
+        opciones.precision = Precision::Doble;
+      } else if (precision == "simple") {
+        opciones.precision = Precision::Simple;
+      } else {
+        throw invalid_argument("Precisión no válida: " + precision);
+      }
+    } else if (argumento == "--metrica" && i + 1 < argc) {
+      opciones.metrica = leerMetrica(argv[++i]);
+    } else if (argumento == "--objetivo" && i + 1 < argc) {
+      opciones.objetivo = leerObjetivo(argv[++i]);
+    } else if (argumento == "--memoria-distancias" && i + 1 < argc) {
+      int megas = stoi(argv[++i]);
+      if (megas <= 0) {
+        throw invalid_argument("La memoria de la caché de distancias debe ser mayor que cero");
+      }
+      opciones.memoriaDistancias = size_t(megas) << 20;
+    } else if (argumento == "--hilos" && i + 1 < argc) {
+      int hilos = stoi(argv[++i]);
+      if (hilos <= 0) {
+        throw invalid_argument("El número de hilos debe ser mayor que cero");
+      }
+      opciones.hilos = hilos;
+    } else if (argumento == "--puntos-control" && i + 1 < argc) {
+      opciones.puntosControl = argv[++i];
+    } else if (argumento == "--intervalo-puntos-control" && i + 1 < argc) {
+      double intervalo = stod(argv[++i]);
+      if (intervalo <= 0.0) {
+        throw invalid_argument("El intervalo entre puntos de control debe ser mayor que cero");
+      }
+      opciones.intervaloPuntosControl = intervalo;
+    } else if (argumento == "--procesos" && i + 1 < argc) {
+      int procesos = stoi(argv[++i]);
+      if (procesos <= 0) {
+        throw invalid_argument("El número de procesos debe ser mayor que cero");
+      }
+      opciones.procesos = procesos;
+    } else if (argumento == "--profundidad-reparto" && i + 1 < argc) {
+      int profundidad = stoi(argv[++i]);
+      if (profundidad <= 0) {
+        throw invalid_argument("La profundidad de reparto debe ser mayor que cero");
+      }
+      opciones.profundidadReparto = profundidad;
+    } else if (argumento == "--semilla" && i + 1 < argc) {
+      opciones.semilla = stoul(argv[++i]);
+    } else if (argumento == "--referencias" && i + 1 < argc) {
+      opciones.referencias = argv[++i];
+    } else if (argumento == "--tolerancia" && i + 1 < argc) {
+      double tolerancia = stod(argv[++i]);
+      if (tolerancia < 0.0) {
+        throw invalid_argument("La tolerancia no puede ser negativa");
+      }
+      opciones.tolerancia = tolerancia;
+    } else if (argumento == "--verificar") {
+      opciones.verificar = true;
+    } else if (argumento == "--actualizar-referencias") {
+      opciones.actualizarReferencias = true;
+    } else if (argumento == "--reanudar") {
+      opciones.reanudar = true;
+    } else if (argumento == "--sin-cache") {
+      opciones.usarCache = false;
+    } else if (argumento == "--distancias") {
+      opciones.conDistancias = true;
+    } else {
+      throw invalid_argument("Argumento no válido: " + argumento);
+    }
+  }
+  if (opciones.reanudar && opciones.puntosControl.empty()) {
+    throw invalid_argument("--reanudar necesita --puntos-control");
+  }
+  if (opciones.procesos > 1 && !opciones.puntosControl.empty()) {
+    throw invalid_argument("Los puntos de control solo se admiten con un proceso");
+  }
+  if (opciones.actualizarReferencias && !opciones.verificar) {
+    throw invalid_argument("--actualizar-referencias necesita --verificar");
+  }
+  return opciones;
 }
 
 /**
- * @brief Función para leer los ficheros de datos
+ * @brief Función para obtener los ficheros de datos de un directorio
  * @param directorio Directorio donde se encuentran los ficheros
- * @return vector<Dato> Vector de estructuras Dato con los datos leídos
+ * @details Rutas ordenadas por el nombre del fichero
+ * @return vector<fs::path> Rutas de los ficheros
  */
-vector<Dato> leerFicheros(const string& directorio) {
-  vector<Dato> datos;
+vector<fs::path> listarFicheros(const string& directorio) {
+  vector<fs::path> rutas;
   for (const auto& entrada : fs::directory_iterator(directorio)) {
     // Verifico que la entrada es un fichero
     if (fs::is_regular_file(entrada)) {
-      Dato dato;
-      int numPuntos, tamanio;
-      string nombreFichero = entrada.path().filename().string();
-      ifstream fichero(entrada.path().string()); // Abro el fichero con la ruta completa
+      rutas.push_back(entrada.path());
+    }
+  }
+  sort(rutas.begin(), rutas.end(), [](const fs::path& a, const fs::path& b) {
+    return a.filename().string() < b.filename().string();
+  });
+  return rutas;
+}
 
-      dato.nombreFichero = nombreFichero;
+/**
+ * @brief Función para leer un fichero de datos en formato texto
+ * @param ruta Ruta del fichero
+ * @return Dato Estructura con los datos leídos
+ */
+Dato leerFicheroTexto(const fs::path& ruta) {
+  Dato dato;
+  int numPuntos, tamanio;
+  ifstream fichero(ruta.string()); // Abro el fichero con la ruta completa
 
-      fichero >> numPuntos >> tamanio;
-      dato.numPuntos = numPuntos;
-      dato.tamanio = tamanio;
+  dato.nombreFichero = ruta.filename().string();
 
-      if (tamanio <= 0) {
-        throw invalid_argument("La dimensión debe ser mayor que cero");
-      }
-      if (numPuntos <= 0) {
-        throw invalid_argument("El número de puntos debe ser mayor que cero");
-      }
-    
-      for (int i = 0; i < numPuntos; i++) {
-        vector<double> punto(tamanio);
-        for (int j = 0; j < tamanio; j++) {
-          fichero >> punto[j];
-        }
-        dato.espacioVectorial.agregarPunto(Punto(i + 1, punto));
-      }
-      datos.push_back(dato);
-      fichero.close();
+  fichero >> numPuntos >> tamanio;
+  dato.numPuntos = numPuntos;
+  dato.tamanio = tamanio;
+
+  if (tamanio <= 0) {
+    throw invalid_argument("La dimensión debe ser mayor que cero");
+  }
+  if (numPuntos <= 0) {
+    throw invalid_argument("El número de puntos debe ser mayor que cero");
+  }
+
+  for (int i = 0; i < numPuntos; i++) {
+    vector<double> punto(tamanio);
+    for (int j = 0; j < tamanio; j++) {
+      fichero >> punto[j];
+    }
+    dato.espacioVectorial.agregarPunto(Punto(i + 1, punto));
+  }
+  fichero.close();
+  return dato;
+}
+
+/**
+ * @brief Función para leer un fichero de datos
+ * @param ruta Ruta del fichero
+ * @param opciones Opciones de la línea de comandos
+ * @details Si existe una caché binaria válida se carga de ella; si no, se lee el
+ * texto y se genera la caché para las siguientes ejecuciones
+ * @return Dato Estructura con los datos leídos
+ */
+Dato leerFichero(const fs::path& ruta, const Opciones& opciones) {
+  Dato dato;
+  if (opciones.usarCache && cargarCache(ruta, dato, opciones.conDistancias, opciones.precision, opciones.metrica)) {
+    dato.distancias = Distancias(dato.espacioVectorial, opciones.precision, opciones.metrica);
+    return dato;
+  }
+  dato = leerFicheroTexto(ruta);
+  dato.distancias = Distancias(dato.espacioVectorial, opciones.precision, opciones.metrica);
+  if (opciones.conDistancias) {
+    dato.matrizDistancias.calcular(dato.distancias);
+  }
+  if (opciones.usarCache) {
+    try {
+      guardarCache(ruta, dato);
+    } catch (const exception& e) {
+      // La caché es opcional: si no se puede escribir se sigue con los datos leídos
+      cerr << "Aviso: " << e.what() << endl;
+    }
+  }
+  return dato;
+}
+
+/**
+ * @brief Función para procesar los ficheros de un directorio uno a uno
+ * @param opciones Opciones de la línea de comandos
+ * @param opcion Algoritmo seleccionado por el usuario
+ * @details Solo se mantienen en memoria el fichero que se está resolviendo y
+ * los de la ventana de precarga, que se leen en segundo plano
+ * @return void
+ */
+void procesarFicheros(const Opciones& opciones, const int opcion) {
+  if (opcion < 1 || opcion > 3) {
+    throw invalid_argument("Opción no válida");
+  }
+  vector<fs::path> rutas = listarFicheros(opciones.directorio);
+
+  // Los resultados se añaden al fichero de salida si se ha indicado uno
+  ofstream fichero;
+  if (!opciones.salida.empty()) {
+    fichero.open(opciones.salida, ios::app);
+    if (!fichero) {
+      throw runtime_error("No se puede abrir el fichero de salida " + opciones.salida);
     }
   }
-  return ordenarDatos(datos);
+  unique_ptr<Sumidero> sumidero = crearSumidero(opciones.formato, opciones.salida.empty() ? cout : fichero);
+  GrupoHilos hilos(opciones.hilos);
+  deque<future<Dato>> pendientes;
+  size_t siguiente = 0;
+
+  while (siguiente < rutas.size() || !pendientes.empty()) {
+    // Relleno la ventana de precarga
+    while (siguiente < rutas.size() && pendientes.size() <= opciones.ventana) {
+      pendientes.push_back(async(launch::async, leerFichero, rutas[siguiente++], cref(opciones)));
+    }
+    Dato dato = pendientes.front().get();
+    pendientes.pop_front();
+    ejecutarAlgoritmo(dato, opcion, opciones, *sumidero, hilos);
+  }
+  mostrarExito(opcion, flujoMensajes(opciones));
+}
+
+/**
+ * @brief Función para obtener el flujo del menú y de los mensajes para el usuario
+ * @param opciones Opciones de la línea de comandos
+ * @details Con csv o json la salida estándar solo lleva registros, para que se pueda
+ * leer sin filtrar; los mensajes van entonces a la salida de error
+ * @return ostream& cout con el formato tabla; cerr con los demás
+ */
+ostream& flujoMensajes(const Opciones& opciones) {
+  return opciones.formato == "tabla" ? cout : cerr;
 }
 
 /**
  * @brief Función para mostrar el menú de opciones
+ * @param os Flujo donde se muestra
  * @return void
  */
-void mostrarMenu() {
-  cout << "Seleccione el algoritmo a ejecutar:" << endl;
-  cout << "1. Algoritmo Voraz" << endl;
-  cout << "2. Algoritmo GRASP" << endl;
-  cout << "3. Algoritmo de Ramificación y Poda" << endl;
-  cout << "Seleccione una opción: ";
+void mostrarMenu(ostream& os) {
+  os << "Seleccione el algoritmo a ejecutar:" << endl;
+  os << "1. Algoritmo Voraz" << endl;
+  os << "2. Algoritmo GRASP" << endl;
+  os << "3. Algoritmo de Ramificación y Poda" << endl;
+  os << "Seleccione una opción: ";
+}
+
+/**
+ * @brief Función para mostrar el mensaje final del algoritmo ejecutado
+ * @param opcion Opción seleccionada por el usuario
+ * @param os Flujo donde se muestra
+ * @return void
+ */
+void mostrarExito(const int opcion, ostream& os) {
+  switch (opcion) {
+    case 1:
+      os << "Algoritmo Voraz ejecutado con éxito." << endl;
+      break;
+    case 2:
+      os << "Algoritmo GRASP ejecutado con éxito." << endl;
+      break;
+    case 3:
+      os << "Algoritmo de Ramificación y Poda ejecutado con éxito." << endl;
+      break;
+  }
 }
 
 /**
  * @brief Función para ejecutar el algoritmo seleccionado
- * @param datos Vector de estructuras Dato con los datos a procesar
+ * @param dato Estructura Dato con los datos a procesar
  * @param opcion Opción seleccionada por el usuario
+ * @param opciones Opciones de la línea de comandos
+ * @param sumidero Sumidero donde se registran los resultados
+ * @param hilos Grupo de hilos para las fases paralelas
  * @return void
  */
-void ejecutarAlgoritmo(vector<Dato>& datos, const int opcion) {
+void ejecutarAlgoritmo(Dato& dato, const int opcion, const Opciones& opciones, Sumidero& sumidero, GrupoHilos& hilos) {
   switch (opcion) {
     case 1: 
-      ejecutarVoraz(datos, 5);
+      ejecutarVoraz(dato, 5, opciones, sumidero);
       break;
     case 2:
-      ejecutarGrasp(datos, 5);
+      ejecutarGrasp(dato, 5, opciones, sumidero);
       break;
     case 3:
-      ejecutarRamificacionPoda(datos, 5);
+      ejecutarRamificacionPoda(dato, 5, opciones, sumidero, hilos);
       break;
     default:
-      invalid_argument("Opción no válida");
-      break;
+      throw invalid_argument("Opción no válida");
   }
 }
 
 /**
  * @brief Función para ejecutar el algoritmo Voraz
- * @param datos Vector de estructuras Dato con los datos a procesar
+ * @param dato Estructura Dato con los datos a procesar
  * @param numPuntosAlejados Número de puntos alejados a seleccionar
+ * @param opciones Opciones de la línea de comandos
+ * @param sumidero Sumidero donde se registran los resultados
  * @return void
  */
-void ejecutarVoraz(vector<Dato>& datos, int numPuntosAlejados) {
-  for (auto& dato : datos) {
-    auto voraz = make_unique<Voraz>();
-    voraz->setDato(dato);
-    for (int i = 2; i <= numPuntosAlejados; i++) {
-      voraz->setNumPuntosAlejados(i);
-      voraz->ejecutar();
-    }
-    voraz->mostrarResultados();
+void ejecutarVoraz(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero) {
+  auto voraz = make_unique<Voraz>();
+  voraz->setDato(dato);
+  voraz->setObjetivo(opciones.objetivo);
+  for (int i = 2; i <= numPuntosAlejados; i++) {
+    voraz->setNumPuntosAlejados(i);
+    voraz->ejecutar();
   }
-  cout << "Algoritmo Voraz ejecutado con éxito." << endl;
+  sumidero.registrar(voraz->getResultados());
 }
 
 /**
  * @brief Función para ejecutar el algoritmo GRASP
- * @param datos Vector de estructuras Dato con los datos a procesar
+ * @param dato Estructura Dato con los datos a procesar
  * @param numPuntosAlejados Número de puntos alejados a seleccionar
+ * @param opciones Opciones de la línea de comandos
+ * @param sumidero Sumidero donde se registran los resultados
  * @return void
  */
-void ejecutarGrasp(vector<Dato>& datos, int numPuntosAlejados) {
-  for (auto& dato : datos) {
-    auto grasp = make_unique<Grasp>();
-    grasp->setDato(dato);
-    for (int i = 2; i <= numPuntosAlejados; i++) {
-      grasp->setNumPuntosAlejados(i);
-      for (int j = 1; j <= 2; j++) {
-        for (int k = 2; k <= 3; k++) {
-          grasp->setMejoresPuntos(k);
-          grasp->ejecutar();
-        }
+void ejecutarGrasp(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero) {
+  auto grasp = make_unique<Grasp>();
+  grasp->setDato(dato);
+  grasp->setObjetivo(opciones.objetivo);
+  if (opciones.semilla) grasp->setSemilla(*opciones.semilla);
+  for (int i = 2; i <= numPuntosAlejados; i++) {
+    grasp->setNumPuntosAlejados(i);
+    for (int j = 1; j <= 2; j++) {
+      for (int k = 2; k <= 3; k++) {
+        grasp->setMejoresPuntos(k);
+        grasp->ejecutar();
       }
     }
-    grasp->mostrarResultados();
   }
-  cout << "Algoritmo GRASP ejecutado con éxito." << endl;
+  sumidero.registrar(grasp->getResultados());
 }
 
 /**
  * @brief Función para ejecutar el algoritmo de Ramificación y Poda
- * @param datos Vector de estructuras Dato con los datos a procesar
+ * @param dato Estructura Dato con los datos a procesar
  * @param numPuntosAlejados Número de puntos alejados a seleccionar
+ * @param opciones Opciones de la línea de comandos
+ * @param sumidero Sumidero donde se registran los resultados
+ * @param hilos Grupo de hilos para las precomputaciones
  * @return void
  */
-void ejecutarRamificacionPoda(vector<Dato>& datos, int numPuntosAlejados) {
-  for (auto& dato : datos) {
-    auto ramificacionPoda = make_unique<RamificacionPoda>();
-    ramificacionPoda->setDato(dato);
-    for (int i = 2; i <= numPuntosAlejados; i++) {
-      ramificacionPoda->setNumPuntosAlejados(i);
-      ramificacionPoda->ejecutar();
-    }
-    ramificacionPoda->mostrarResultados();
+void ejecutarRamificacionPoda(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero, GrupoHilos& hilos) {
+  auto ramificacionPoda = make_unique<RamificacionPoda>();
+  ramificacionPoda->setDato(dato);
+  ramificacionPoda->setObjetivo(opciones.objetivo);
+  ramificacionPoda->setLimiteMemoriaDistancias(opciones.memoriaDistancias);
+  ramificacionPoda->setGrupoHilos(&hilos);
+  ramificacionPoda->setPuntoControl(opciones.puntosControl, opciones.intervaloPuntosControl, opciones.reanudar);
+  ramificacionPoda->setProcesos(opciones.procesos, opciones.profundidadReparto);
+  ramificacionPoda->setSemilla(opciones.semilla);
+  for (int i = 2; i <= numPuntosAlejados; i++) {
+    ramificacionPoda->setNumPuntosAlejados(i);
+    ramificacionPoda->ejecutar();
   }
-  cout << "Algoritmo de Ramificación y Poda ejecutado con éxito." << endl;
-}
\ No newline at end of file
+  sumidero.registrar(ramificacionPoda->getResultados());
+}
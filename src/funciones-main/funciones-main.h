@@ -9,21 +9,57 @@
 #include "../algoritmo/voraz/voraz.h"
 #include "../algoritmo/grasp/grasp.h"
 #include "../algoritmo/ramificacion-poda/ramificacion-poda.h"
+#include "../cache/cache.h"
+#include "../sumidero/sumidero.h"
 #include <stdexcept> // Para las excepciones
 #include <filesystem> // Para la gestión de ficheros
 #include <fstream> // Para la lectura de ficheros
+#include <future> // Para la precarga de ficheros
+#include <deque> // Para la ventana de precarga
+#include <optional> // Para la semilla opcional
 
 namespace fs = filesystem;
 
+// Opciones de la línea de comandos
+struct Opciones {
+  string directorio; // Directorio con los ficheros de datos
+  size_t ventana = 1; // Número de ficheros precargados mientras se resuelve el actual
+  bool usarCache = true; // Si se usa la caché binaria de las instancias
+  bool conDistancias = false; // Si se precalcula (y se guarda en la caché) la matriz de distancias
+  Precision precision = Precision::Doble; // Precisión de las tablas de distancias (los puntos siguen en doble)
+  TipoObjetivo objetivo = TipoObjetivo::Suma; // Función objetivo que maximizan los algoritmos
+  Metrica metrica = Metrica::Euclidea; // Métrica de las distancias entre puntos
+  size_t memoriaDistancias = size_t(256) << 20; // Memoria máxima de la caché de distancias de ramificación y poda
+  size_t hilos = thread::hardware_concurrency(); // Hilos para las fases paralelas
+  string formato = "tabla"; // Formato de los resultados (tabla, csv o json)
+  string salida; // Fichero donde se añaden los resultados (vacío para la salida estándar)
+  string puntosControl; // Directorio de los puntos de control de ramificación y poda (vacío para no guardarlos)
+  double intervaloPuntosControl = 60.0; // Segundos entre puntos de control
+  bool reanudar = false; // Si se reanudan las búsquedas desde sus puntos de control
+  size_t procesos = 1; // Procesos trabajadores de ramificación y poda (1 para no repartir)
+  int profundidadReparto = 2; // Nivel de los subárboles que se reparten entre los procesos
+  optional<uint32_t> semilla; // Semilla de GRASP (aleatoria si no se indica)
+  bool verificar = false; // Si se verifican los algoritmos en lugar de mostrar el menú
+  string referencias = "referencias/rendimiento.csv"; // Fichero de referencias de rendimiento de la verificación
+  bool actualizarReferencias = false; // Si la verificación guarda sus medidas como nuevas referencias
+  double tolerancia = 0.25; // Exceso relativo sobre las referencias que se tolera en la verificación
+};
+
+Opciones leerOpciones(int argc, char* argv[]);
+
 // Funciones para gestionar los ficheros
-vector<Dato> leerFicheros(const string& directorio);
-vector<Dato> ordenarDatos(vector<Dato>& datos);
+vector<fs::path> listarFicheros(const string& directorio);
+Dato leerFicheroTexto(const fs::path& ruta);
+Dato leerFichero(const fs::path& ruta, const Opciones& opciones);
+void procesarFicheros(const Opciones& opciones, const int opcion);
 // Funciones para ejecutar los algoritmos
-void ejecutarAlgoritmo(vector<Dato>& datos, const int opcion);
-void ejecutarVoraz(vector<Dato>& datos, int numPuntosAlejados);
-void ejecutarGrasp(vector<Dato>& datos, int numPuntosAlejados);
-void ejecutarRamificacionPoda(vector<Dato>& datos, int numPuntosAlejados);
+void ejecutarAlgoritmo(Dato& dato, const int opcion, const Opciones& opciones, Sumidero& sumidero, GrupoHilos& hilos);
+void ejecutarVoraz(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero);
+void ejecutarGrasp(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero);
+void ejecutarRamificacionPoda(Dato& dato, int numPuntosAlejados, const Opciones& opciones, Sumidero& sumidero, GrupoHilos& hilos);
 
-void mostrarMenu(); // Mostrar el menú de opciones
+ostream& flujoMensajes(const Opciones& opciones); // Flujo del menú y de los mensajes para el usuario
+void mostrarMenu(ostream& os = cout); // Mostrar el menú de opciones
+void mostrarExito(const int opcion, ostream& os = cout); // Mostrar el mensaje final del algoritmo
 
-#endif
\ No newline at end of file
+#endif
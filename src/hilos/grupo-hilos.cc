@@ -0,0 +1,101 @@
+#include "grupo-hilos.h"
+#include <algorithm>
+#include <exception>
+
+/**
+ * @brief Constructor del grupo de hilos
+ * @param numHilos Número de hilos (al menos uno)
+ */
+GrupoHilos::GrupoHilos(size_t numHilos) {
+  numHilos = max<size_t>(1, numHilos);
+  for (size_t i = 0; i < numHilos; ++i) {
+    hilos_.emplace_back(&GrupoHilos::trabajar, this);
+  }
+}
+
+/**
+ * @brief Destructor: termina las tareas pendientes y espera a los hilos
+ */
+GrupoHilos::~GrupoHilos() {
+  {
+    lock_guard<mutex> bloqueo(cerrojo_);
+    terminar_ = true;
+  }
+  hayTareas_.notify_all();
+  for (auto& hilo : hilos_) {
+    hilo.join();
+  }
+}
+
+/**
+ * @brief Método para encolar una tarea
+ * @param tarea Tarea a ejecutar en algún hilo del grupo
+ * @return void
+ */
+void GrupoHilos::encolar(function<void()> tarea) {
+  {
+    lock_guard<mutex> bloqueo(cerrojo_);
+    tareas_.push(move(tarea));
+  }
+  hayTareas_.notify_one();
+}
+
+/**
+ * @brief Método para repartir un rango de elementos entre los hilos
+ * @param numElementos Número de elementos del rango [0, numElementos)
+ * @param tarea Función que procesa un tramo [inicio, fin)
+ * @details Bloquea hasta que todos los tramos han terminado. El rango se divide en
+ * varios tramos por hilo para equilibrar la carga. Si algún tramo lanza una excepción,
+ * se relanza aquí
+ * @return void
+ */
+void GrupoHilos::paraCada(size_t numElementos, const function<void(size_t inicio, size_t fin)>& tarea) {
+  if (numElementos == 0) return;
+  const size_t numTramos = min(numElementos, hilos_.size() * 4);
+  const size_t tamanioTramo = (numElementos + numTramos - 1) / numTramos;
+
+  mutex cerrojoFin;
+  condition_variable finTramo;
+  size_t pendientes = 0;
+  exception_ptr error;
+
+  for (size_t inicio = 0; inicio < numElementos; inicio += tamanioTramo) {
+    const size_t fin = min(numElementos, inicio + tamanioTramo);
+    {
+      lock_guard<mutex> bloqueo(cerrojoFin);
+      pendientes++;
+    }
+    encolar([&, inicio, fin]() {
+      try {
+        tarea(inicio, fin);
+      } catch (...) {
+        lock_guard<mutex> bloqueo(cerrojoFin);
+        if (!error) error = current_exception();
+      }
+      lock_guard<mutex> bloqueo(cerrojoFin);
+      if (--pendientes == 0) finTramo.notify_all();
+    });
+  }
+
+  unique_lock<mutex> bloqueo(cerrojoFin);
+  finTramo.wait(bloqueo, [&pendientes]() { return pendientes == 0; });
+  if (error) rethrow_exception(error);
+}
+
+/**
+ * @brief Bucle de cada hilo: ejecuta tareas hasta que se pide terminar
+ * @return void
+ */
+void GrupoHilos::trabajar() {
+  while (true) {
+    function<void()> tarea;
+    {
+      unique_lock<mutex> bloqueo(cerrojo_);
+      hayTareas_.wait(bloqueo, [this]() { return terminar_ || !tareas_.empty(); });
+      if (tareas_.empty()) return;
+      tarea = move(tareas_.front());
+      tareas_.pop();
+    }
+    tarea();
+  }
+}
@@ -0,0 +1,45 @@
+/**
+ * @class Clase para representar un grupo de hilos reutilizable
+ * @details Los hilos se crean una vez y ejecutan las tareas encoladas hasta que se
+ * destruye el grupo, evitando crear hilos en cada fase paralela
+ */
+
+#ifndef GRUPO_HILOS_H
+#define GRUPO_HILOS_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <vector>
+
+using namespace std;
+
+class GrupoHilos {
+  public:
+    // Constructor y destructor
+    explicit GrupoHilos(size_t numHilos = thread::hardware_concurrency());
+    ~GrupoHilos();
+
+    GrupoHilos(const GrupoHilos&) = delete;
+    GrupoHilos& operator=(const GrupoHilos&) = delete;
+
+    // Métodos de la clase
+    void encolar(function<void()> tarea);
+    void paraCada(size_t numElementos, const function<void(size_t inicio, size_t fin)>& tarea);
+
+    // Getters
+    inline size_t getNumHilos() const { return hilos_.size(); }
+
+  private:
+    void trabajar();
+
+    vector<thread> hilos_; // Hilos del grupo
+    queue<function<void()>> tareas_; // Tareas pendientes
+    mutex cerrojo_; // Protege la cola de tareas
+    condition_variable hayTareas_; // Avisa a los hilos de que hay tareas o de que deben terminar
+    bool terminar_ = false; // Si los hilos deben terminar
+};
+
+#endif
@@ -1,4 +1,6 @@
 #include "funciones-main/funciones-main.h"
+#include "verificacion/verificacion.h"
+#include "servidor-procesos/servidor-procesos.h"
 
 /**
  * @brief Función principal
@@ -7,21 +9,23 @@
  */
 
 int main(int argc, char* argv[]) {
-  if (argc != 2) {
-    cerr << "Uso: " << argv[0] << " <directorio>" << endl;
-    return 1;
-  }
   try {
-    string directorio = argv[1];
-    vector<Dato> datos = leerFicheros(directorio);
-    mostrarMenu();
+    Opciones opciones = leerOpciones(argc, argv);
+    if (opciones.procesos > 1) {
+      // Antes de crear ningún hilo, para que los trabajadores no se creen con fork desde un proceso con hilos
+      iniciarServidorProcesos(&RamificacionPoda::ejecutarTrabajador);
+    }
+    if (opciones.verificar) {
+      return verificar(opciones);
+    }
+    mostrarMenu(flujoMensajes(opciones));
     int opcion;
     cin >> opcion;
-    ejecutarAlgoritmo(datos, opcion);
+    procesarFicheros(opciones, opcion);
   } catch (const exception& e) {
     cerr << "Error: " << e.what() << endl;
     return 1;
   }
 
   return 0;
-}
\ No newline at end of file
+}
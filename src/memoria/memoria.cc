@@ -0,0 +1,39 @@
+#include "memoria.h"
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+
+using namespace std;
+
+/**
+ * @brief Función para reiniciar el pico de memoria residente del proceso
+ * @details Escribe 5 en /proc/self/clear_refs (Linux 4.0 o posterior); si falla, el
+ * pico sigue siendo el del proceso completo. Reinicia el pico de todo el proceso, no
+ * solo el de quien la llama
+ * @return void
+ */
+void reiniciarMemoriaMaxima() {
+  ofstream fichero("/proc/self/clear_refs");
+  if (fichero) {
+    fichero << "5";
+  }
+}
+
+/**
+ * @brief Función para obtener el pico de memoria residente del proceso
+ * @return size_t Pico de memoria residente en bytes (0 si no se puede medir)
+ */
+size_t memoriaMaxima() {
+  ifstream fichero("/proc/self/status");
+  string linea;
+  while (getline(fichero, linea)) {
+    if (linea.rfind("VmHWM:", 0) == 0) {
+      return stoull(linea.substr(6)) * 1024; // En kB
+    }
+  }
+  struct rusage uso;
+  if (getrusage(RUSAGE_SELF, &uso) != 0) {
+    return 0;
+  }
+  return static_cast<size_t>(uso.ru_maxrss) * 1024; // En kB en Linux
+}
@@ -0,0 +1,20 @@
+/**
+ * @brief Funciones para medir la memoria del proceso
+ * @details El pico de memoria residente se lee de /proc/self/status (VmHWM) y, si no
+ * está disponible, de getrusage. En Linux el pico se puede reiniciar antes de cada
+ * ejecución para medirla por separado; si no se puede, es el pico del proceso completo.
+ * El pico es del proceso: el reinicio afecta a todos sus hilos, así que la medida solo
+ * es la de una ejecución si no hay otras a la vez (varios contextos en paralelo o los
+ * trabajos de un Planificador se reinician el pico entre sí).
+ * La memoria de los procesos trabajadores de ramificación y poda no se incluye
+ */
+
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <cstddef>
+
+void reiniciarMemoriaMaxima();
+size_t memoriaMaxima();
+
+#endif
@@ -0,0 +1,27 @@
+#include "objetivo.h"
+#include <stdexcept> // Para las excepciones
+
+/**
+ * @brief Función para leer una función objetivo por su nombre
+ * @param nombre Nombre (suma, minimo o media)
+ * @return TipoObjetivo Función objetivo
+ */
+TipoObjetivo leerObjetivo(const string& nombre) {
+  if (nombre == "suma") return TipoObjetivo::Suma;
+  if (nombre == "minimo") return TipoObjetivo::Minimo;
+  if (nombre == "media") return TipoObjetivo::Media;
+  throw invalid_argument("Función objetivo no válida: " + nombre);
+}
+
+/**
+ * @brief Función para obtener el nombre de una función objetivo
+ * @param tipo Función objetivo
+ * @return string Nombre que acepta leerObjetivo
+ */
+string nombreObjetivo(TipoObjetivo tipo) {
+  switch (tipo) {
+    case TipoObjetivo::Minimo: return "minimo";
+    case TipoObjetivo::Media: return "media";
+    default: return "suma";
+  }
+}
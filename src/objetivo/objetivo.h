@@ -0,0 +1,168 @@
+/**
+ * @brief Funciones objetivo del problema de máxima diversidad como políticas de compilación
+ * @details Cada política guarda el valor de una selección y ofrece ganchos incrementales:
+ *  - anadir: valor al añadir un punto, a partir de la suma y del mínimo de sus distancias
+ *    a los puntos ya seleccionados (construcción y ramificación)
+ *  - preparar / cambiar: valor al intercambiar un punto de la selección por otro
+ *    (búsqueda local), tras preparar el estado de la selección una vez por cambio
+ *  - final: valor que se informa para una selección de m puntos
+ * Los algoritmos se instancian con la política, así que no hay llamadas virtuales en los
+ * bucles internos. kCotaSuma indica si el valor interno es la suma de parejas (y sirven
+ * sus cotas) o el mínimo de parejas.
+ * No hay variantes ponderadas: las instancias no traen pesos, y una suma con pesos por
+ * pareja (o por punto, w_i * w_j) es max-sum sobre otra distancia, así que su sitio sería
+ * una métrica de Distancias y no una política (las cotas y los vecinos ordenados de
+ * ramificación y poda dependen de la distancia)
+ */
+
+#ifndef OBJETIVO_H
+#define OBJETIVO_H
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Funciones objetivo disponibles
+enum class TipoObjetivo {
+  Suma,   // Max-sum: suma de las distancias entre parejas
+  Minimo, // Max-min: menor distancia entre parejas
+  Media   // Max-mean: suma de las distancias entre parejas dividida entre m
+};
+
+TipoObjetivo leerObjetivo(const string& nombre);
+string nombreObjetivo(TipoObjetivo tipo);
+
+/**
+ * @class Política max-sum
+ */
+class ObjetivoSuma {
+  public:
+    static constexpr bool kCotaSuma = true;
+    static constexpr double inicial() { return 0.0; }
+    static inline double anadir(double valor, double suma, double) { return valor + suma; }
+    static inline double final(double valor, size_t) { return valor; }
+
+    /**
+     * @brief Calcula el valor de la selección
+     */
+    template <class D>
+    void preparar(const D& distancia, const vector<int>& seleccion) {
+      valor_ = 0.0;
+      for (size_t i = 0; i < seleccion.size(); ++i) {
+        for (size_t j = i + 1; j < seleccion.size(); ++j) {
+          valor_ += distancia(seleccion[i], seleccion[j]);
+        }
+      }
+    }
+
+    /**
+     * @brief Valor de la selección si el punto de la posición i se cambia por j
+     */
+    template <class D>
+    double cambiar(const D& distancia, const vector<int>& seleccion, size_t i, int j) const {
+      double delta = 0.0;
+      for (size_t k = 0; k < seleccion.size(); ++k) {
+        if (k != i) {
+          delta += distancia(j, seleccion[k]) - distancia(seleccion[i], seleccion[k]);
+        }
+      }
+      return valor_ + delta;
+    }
+
+    inline double valor() const { return valor_; }
+
+  private:
+    double valor_ = 0.0; // Suma de parejas de la selección preparada
+};
+
+/**
+ * @class Política max-mean
+ * @details Con m fijo ordena las selecciones igual que max-sum, así que busca sobre la
+ * suma de parejas y solo divide al informar el valor
+ */
+class ObjetivoMedia : public ObjetivoSuma {
+  public:
+    static inline double final(double valor, size_t m) { return m > 0 ? valor / m : 0.0; }
+};
+
+/**
+ * @class Política max-min
+ * @details El valor de una selección con menos de dos puntos es infinito
+ */
+class ObjetivoMinimo {
+  public:
+    static constexpr bool kCotaSuma = false;
+    static constexpr double inicial() { return numeric_limits<double>::infinity(); }
+    static inline double anadir(double valor, double, double minimo) { return min(valor, minimo); }
+    static inline double final(double valor, size_t) { return valor; }
+
+    /**
+     * @brief Calcula el mínimo de la selección y, para cada posición, el mínimo sin ella
+     * @details Solo los dos puntos de la pareja mínima tienen un mínimo distinto sin ellos
+     */
+    template <class D>
+    void preparar(const D& distancia, const vector<int>& seleccion) {
+      const size_t m = seleccion.size();
+      auto minimoSin = [&](size_t fuera) {
+        double minimo = inicial();
+        for (size_t i = 0; i < m; ++i) {
+          for (size_t j = i + 1; j < m; ++j) {
+            if (i != fuera && j != fuera) minimo = min(minimo, distancia(seleccion[i], seleccion[j]));
+          }
+        }
+        return minimo;
+      };
+      size_t a = 0, b = 0;
+      valor_ = inicial();
+      for (size_t i = 0; i < m; ++i) {
+        for (size_t j = i + 1; j < m; ++j) {
+          const double d = distancia(seleccion[i], seleccion[j]);
+          if (d < valor_) {
+            valor_ = d;
+            a = i;
+            b = j;
+          }
+        }
+      }
+      minimoSin_.assign(m, valor_);
+      if (m >= 2) {
+        minimoSin_[a] = minimoSin(a);
+        minimoSin_[b] = minimoSin(b);
+      }
+    }
+
+    /**
+     * @brief Valor de la selección si el punto de la posición i se cambia por j
+     */
+    template <class D>
+    double cambiar(const D& distancia, const vector<int>& seleccion, size_t i, int j) const {
+      double minimo = minimoSin_[i];
+      for (size_t k = 0; k < seleccion.size(); ++k) {
+        if (k != i) minimo = min(minimo, distancia(j, seleccion[k]));
+      }
+      return minimo;
+    }
+
+    inline double valor() const { return valor_; }
+
+  private:
+    double valor_ = inicial(); // Mínimo de la selección preparada
+    vector<double> minimoSin_; // Mínimo de la selección sin cada posición
+};
+
+/**
+ * @brief Invoca f con la política de la función objetivo
+ */
+template <class F>
+inline decltype(auto) conObjetivo(TipoObjetivo tipo, F&& f) {
+  switch (tipo) {
+    case TipoObjetivo::Minimo: return f(ObjetivoMinimo{});
+    case TipoObjetivo::Media: return f(ObjetivoMedia{});
+    default: return f(ObjetivoSuma{});
+  }
+}
+
+#endif
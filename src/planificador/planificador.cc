@@ -0,0 +1,114 @@
+#include "planificador.h"
+#include <chrono>
+#include <stdexcept>
+
+/**
+ * @brief Constructor del planificador
+ * @param numHilos Hilos que reanudan los trabajos
+ * @param rebanada Segundos que se reanuda cada trabajo en cada turno
+ */
+Planificador::Planificador(size_t numHilos, double rebanada) : rebanada_(rebanada), hilos_(numHilos) {
+  if (rebanada <= 0.0) {
+    throw invalid_argument("La rebanada de tiempo debe ser mayor que cero");
+  }
+}
+
+/**
+ * @brief Destructor: cancela los trabajos pendientes y espera a los hilos
+ */
+Planificador::~Planificador() {
+  terminar_ = true;
+}
+
+/**
+ * @brief Método para añadir un trabajo
+ * @param tarea Tarea de la resolución (sin empezar o pausada)
+ * @param rebanada Segundos por turno de este trabajo (0 para la del planificador)
+ * @return Trabajo Identificador y resultado futuro del trabajo
+ */
+Planificador::Trabajo Planificador::anadir(Tarea<Resultado> tarea, double rebanada) {
+  if (rebanada < 0.0) {
+    throw invalid_argument("La rebanada de tiempo no puede ser negativa");
+  }
+  auto entrada = make_shared<Entrada>();
+  entrada->tarea = move(tarea);
+  entrada->rebanada = rebanada > 0.0 ? rebanada : rebanada_;
+  Trabajo trabajo;
+  trabajo.resultado = entrada->promesa.get_future();
+  {
+    lock_guard<mutex> bloqueo(cerrojo_);
+    entrada->id = trabajo.id = siguienteId_++;
+    pendientes_[entrada->id] = entrada;
+  }
+  hilos_.encolar([this, entrada]() { ejecutarRebanada(entrada); });
+  return trabajo;
+}
+
+/**
+ * @brief Método para cancelar un trabajo
+ * @param id Identificador del trabajo
+ * @details Se cancela en su siguiente pausa; si ya ha terminado no hace nada
+ * @return void
+ */
+void Planificador::cancelar(size_t id) {
+  lock_guard<mutex> bloqueo(cerrojo_);
+  auto entrada = pendientes_.find(id);
+  if (entrada != pendientes_.end()) {
+    entrada->second->cancelada = true;
+  }
+}
+
+/**
+ * @brief Método para esperar a que terminen (o se cancelen) todos los trabajos
+ * @return void
+ */
+void Planificador::esperar() {
+  unique_lock<mutex> bloqueo(cerrojo_);
+  sinPendientes_.wait(bloqueo, [this]() { return pendientes_.empty(); });
+}
+
+/**
+ * @brief Método para obtener el número de trabajos sin terminar
+ * @return size_t Trabajos pendientes
+ */
+size_t Planificador::getPendientes() const {
+  lock_guard<mutex> bloqueo(cerrojo_);
+  return pendientes_.size();
+}
+
+/**
+ * @brief Método para reanudar un trabajo durante su rebanada
+ * @param entrada Trabajo
+ * @details El reloj se consulta en cada pausa del trabajo, así que la rebanada se puede
+ * pasar en lo que dure un paso. Si el trabajo sigue pendiente vuelve al final de la cola
+ * @return void
+ */
+void Planificador::ejecutarRebanada(const shared_ptr<Entrada>& entrada) {
+  const auto fin = chrono::steady_clock::now() + chrono::duration<double>(entrada->rebanada);
+  bool pendiente = true;
+  try {
+    while (!entrada->cancelada && !terminar_ && (pendiente = entrada->tarea.reanudar())
+           && chrono::steady_clock::now() < fin) {}
+    if (!pendiente) {
+      entrada->promesa.set_value(entrada->tarea.obtener());
+    }
+  } catch (...) {
+    pendiente = false;
+    entrada->promesa.set_exception(current_exception());
+  }
+  if (pendiente && (entrada->cancelada || terminar_)) {
+    // Destruir la corrutina cancela la resolución
+    entrada->tarea = Tarea<Resultado>();
+    entrada->promesa.set_exception(make_exception_ptr(runtime_error("Trabajo cancelado")));
+    pendiente = false;
+  }
+  if (pendiente) {
+    hilos_.encolar([this, entrada]() { ejecutarRebanada(entrada); });
+    return;
+  }
+  lock_guard<mutex> bloqueo(cerrojo_);
+  pendientes_.erase(entrada->id);
+  if (pendientes_.empty()) {
+    sinPendientes_.notify_all();
+  }
+}
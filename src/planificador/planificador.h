@@ -0,0 +1,67 @@
+/**
+ * @class Planificador cooperativo de resoluciones
+ * @details Intercala muchas resoluciones (tareas de Solucionador::resolverPorPasos) en
+ * pocos hilos. Cada trabajo se reanuda durante una rebanada de tiempo y, si no ha
+ * terminado, vuelve al final de la cola, de modo que los trabajos avanzan por turnos.
+ * Los trabajos se pueden cancelar en cualquier pausa: se destruye su corrutina y su
+ * resultado lanza una excepción. Los contextos de los trabajos deben usar un solo hilo,
+ * no medir la memoria (el pico es del proceso y los trabajos se lo reiniciarían entre
+ * sí) y seguir vivos hasta que su trabajo termine
+ */
+
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+#include "../resultado/resultado.h"
+#include "../hilos/grupo-hilos.h"
+#include "../tarea/tarea.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <unordered_map>
+
+class Planificador {
+  public:
+    // Trabajo añadido: identificador para cancelarlo y resultado futuro
+    struct Trabajo {
+      size_t id;
+      future<Resultado> resultado;
+    };
+
+    // Constructor y destructor
+    explicit Planificador(size_t numHilos = 1, double rebanada = 0.005);
+    ~Planificador();
+
+    Planificador(const Planificador&) = delete;
+    Planificador& operator=(const Planificador&) = delete;
+
+    // Métodos de la clase
+    Trabajo anadir(Tarea<Resultado> tarea, double rebanada = 0.0);
+    void cancelar(size_t id);
+    void esperar();
+
+    // Getters
+    size_t getPendientes() const;
+
+  private:
+    // Trabajo en curso, compartido entre la cola del grupo de hilos y la tabla de pendientes
+    struct Entrada {
+      size_t id;
+      Tarea<Resultado> tarea;
+      promise<Resultado> promesa;
+      double rebanada; // Segundos que se reanuda en cada turno
+      atomic<bool> cancelada{false};
+    };
+
+    void ejecutarRebanada(const shared_ptr<Entrada>& entrada);
+
+    double rebanada_; // Rebanada por defecto en segundos
+    atomic<bool> terminar_{false}; // Si se están cancelando todos los trabajos al destruir el planificador
+    mutable mutex cerrojo_; // Protege la tabla de pendientes y el contador de identificadores
+    condition_variable sinPendientes_; // Avisa cuando terminan todos los trabajos
+    unordered_map<size_t, shared_ptr<Entrada>> pendientes_; // Trabajos sin terminar
+    size_t siguienteId_ = 0; // Identificador del siguiente trabajo
+    GrupoHilos hilos_; // Declarado el último para destruirse primero, cuando el resto sigue vivo
+};
+
+#endif
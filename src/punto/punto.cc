@@ -3,18 +3,19 @@
 /**
  * @brief Método para calcular la distancia entre 2 puntos
  * @param otro Otro punto
- * @details Para calcular la distancia entre 2 puntos, se utiliza la fórmula de la distancia euclidiana
+ * @param metrica Métrica de la distancia (euclídea por defecto)
+ * @details Para cálculos masivos sobre una instancia es preferible la clase Distancias
  * @return Distancia entre los 2 puntos
  */
-double Punto::calcularDistancia(const Punto& otro) const {
+double Punto::calcularDistancia(const Punto& otro, Metrica metrica) const {
   if (punto_.size() != otro.punto_.size()) {
     throw invalid_argument("Los puntos deben tener la misma dimensión");
   }
-  double suma = 0;
-  for (size_t i = 0; i < punto_.size(); ++i) {
-    suma += pow(punto_[i] - otro.punto_[i], 2);
-  }
-  return sqrt(suma);
+  return conMetrica(metrica, [&](auto m) {
+    return conDimension(punto_.size(), [&](auto d) {
+      return distancia<decltype(m)::value, decltype(d)::value>(punto_.data(), otro.punto_.data(), punto_.size());
+    });
+  });
 }
 
 /**
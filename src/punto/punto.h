@@ -8,6 +8,8 @@
 #include <iostream>
 #include <vector>
 #include <cmath> // Para calcular la distancia
+#include <algorithm> // Para find y sort
+#include "../distancia/nucleos.h" // Núcleos de distancia especializados
 
 using namespace std;
 
@@ -19,11 +21,12 @@ class Punto {
     Punto(const vector<double>& punto) : identificador_(-1), punto_(punto) {}
 
     // Métodos de la clase
-    double calcularDistancia(const Punto& otro) const;
+    double calcularDistancia(const Punto& otro, Metrica metrica = Metrica::Euclidea) const;
 
     // Getters
     inline int getDimension() const { return punto_.size(); }
     inline double getCoordenada(int i) const { return punto_[i]; }
+    inline const double* getCoordenadas() const { return punto_.data(); }
     inline int getIndice() const { return identificador_; }
 
     // Sobrecarga del operador de salida
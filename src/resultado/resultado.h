@@ -0,0 +1,33 @@
+/**
+ * @struct Struct para representar el resultado de una ejecución de un algoritmo
+ */
+
+#ifndef RESULTADO_H
+#define RESULTADO_H
+
+#include "../dato/dato.h"
+#include "../objetivo/objetivo.h"
+
+struct Resultado {
+  const Dato* dato; // Instancia resuelta (no se copia, debe seguir viva mientras se use el resultado)
+  string algoritmo; // Nombre del algoritmo
+  TipoObjetivo objetivo = TipoObjetivo::Suma; // Función objetivo optimizada
+
+  int numPuntosAlejados; // Número de puntos seleccionados (m)
+  int tamanioLRC = 0; // Tamaño de la lista restringida de candidatos (0 si no aplica)
+
+  double z; // Valor de la función objetivo
+  double tiempoCPU; // Tiempo de CPU en segundos
+  size_t memoriaMaxima = 0; // Pico de memoria residente del proceso durante la ejecución (bytes; 0 si no se mide)
+  size_t memoriaTablas = 0; // Bytes de las tablas precalculadas (coordenadas, distancias y vecinos)
+  size_t memoriaAbiertos = 0; // Bytes reservados por la lista abierta de ramificación y poda
+  size_t nodosAbiertosMaximos = 0; // Máximo de nodos a la vez en la lista abierta
+  size_t nodosGenerados = 0; // Nodos generados en el algoritmo de ramificación y poda
+  size_t nodosPodados = 0; // Nodos podados en el algoritmo de ramificación y poda
+  size_t puntosEliminados = 0; // Puntos descartados antes de la búsqueda en ramificación y poda
+  bool interrumpido = false; // Si el presupuesto detuvo la búsqueda (z puede no ser óptimo)
+
+  vector<int> seleccion; // Índices en la instancia de los puntos seleccionados
+};
+
+#endif
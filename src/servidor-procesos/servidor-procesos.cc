@@ -0,0 +1,108 @@
+#include "servidor-procesos.h"
+#include <cstring> // Para memcpy
+#include <iostream>
+#include <mutex>
+#include <stdexcept> // Para las excepciones
+#include <signal.h> // Para no esperar a los trabajadores
+#include <unistd.h> // Para fork y _exit
+
+namespace {
+
+Canal servidor; // Canal del proceso principal con el servidor (cerrado si no se ha iniciado)
+mutex cerrojoServidor; // Una petición a la vez al servidor
+
+/**
+ * @brief Bucle del proceso servidor: crea un trabajador por cada petición
+ * @param canal Canal con el proceso principal
+ * @param trabajador Función que ejecuta cada trabajador con el canal de su coordinador
+ * @details Termina cuando el proceso principal cierra el canal. Ignora SIGCHLD para que
+ * el sistema recoja a los trabajadores que terminan sin dejar procesos zombis
+ */
+[[noreturn]] void atenderPeticiones(Canal& canal, int (*trabajador)(Canal&)) {
+  signal(SIGCHLD, SIG_IGN);
+  uint32_t tipo;
+  vector<char> datos;
+  try {
+    while (canal.recibir(tipo, datos)) {
+      auto extremos = Canal::crearPar();
+      pid_t pid = fork();
+      if (pid == 0) {
+        signal(SIGCHLD, SIG_DFL);
+        canal.cerrar();
+        extremos.first.cerrar();
+        _exit(trabajador(extremos.second));
+      }
+      vector<char> respuesta(sizeof(pid));
+      memcpy(respuesta.data(), &pid, sizeof(pid));
+      canal.enviar(0, respuesta);
+      if (pid > 0) {
+        canal.enviarCanal(extremos.first);
+      }
+    }
+  } catch (const exception& e) {
+    cerr << "Error en el servidor de procesos: " << e.what() << endl;
+    _exit(1);
+  }
+  _exit(0);
+}
+
+} // namespace
+
+/**
+ * @brief Función para lanzar el servidor de procesos trabajadores
+ * @param trabajador Función que ejecuta cada trabajador con el canal de su coordinador
+ * (su resultado es el código de salida del proceso)
+ * @details Hay que llamarla antes de crear ningún hilo; si el servidor ya está iniciado
+ * no hace nada. El servidor termina cuando termina el proceso principal
+ * @return void
+ */
+void iniciarServidorProcesos(int (*trabajador)(Canal&)) {
+  lock_guard<mutex> cerrojo(cerrojoServidor);
+  if (servidor.getDescriptor() >= 0) return;
+  auto extremos = Canal::crearPar();
+  cout.flush();
+  cerr.flush();
+  pid_t pid = fork();
+  if (pid < 0) {
+    throw runtime_error("No se puede crear el servidor de procesos");
+  }
+  if (pid == 0) {
+    extremos.first.cerrar();
+    atenderPeticiones(extremos.second, trabajador);
+  }
+  servidor = move(extremos.first);
+}
+
+/**
+ * @brief Función para saber si el servidor de procesos está iniciado
+ * @return true si se pueden crear procesos trabajadores
+ */
+bool servidorProcesosIniciado() {
+  lock_guard<mutex> cerrojo(cerrojoServidor);
+  return servidor.getDescriptor() >= 0;
+}
+
+/**
+ * @brief Función para crear un proceso trabajador a través del servidor
+ * @details El trabajador es hijo del servidor, no de quien lo pide: no se puede esperar
+ * con waitpid (el servidor lo recoge al terminar) y su final se detecta al cerrarse el canal
+ * @return pair<Canal, pid_t> Canal con el trabajador e identificador de su proceso
+ */
+pair<Canal, pid_t> crearProcesoTrabajador() {
+  lock_guard<mutex> cerrojo(cerrojoServidor);
+  if (servidor.getDescriptor() < 0) {
+    throw runtime_error("El servidor de procesos no está iniciado");
+  }
+  uint32_t tipo;
+  vector<char> datos;
+  servidor.enviar(0);
+  if (!servidor.recibir(tipo, datos) || datos.size() != sizeof(pid_t)) {
+    throw runtime_error("El servidor de procesos ha terminado inesperadamente");
+  }
+  pid_t pid;
+  memcpy(&pid, datos.data(), sizeof(pid));
+  if (pid < 0) {
+    throw runtime_error("No se puede crear un proceso trabajador");
+  }
+  return {servidor.recibirCanal(), pid};
+}
@@ -0,0 +1,22 @@
+/**
+ * @brief Funciones para crear procesos trabajadores desde un servidor de procesos
+ * @details fork() en un proceso con hilos solo copia el hilo que lo llama, y el hijo
+ * puede heredar cerrojos tomados por los demás (los del asignador de memoria o de los
+ * flujos de salida). Por eso los trabajadores no se crean desde el proceso principal:
+ * al principio del programa, antes de crear ningún hilo, se lanza un servidor de un solo
+ * hilo que hace los fork() que se le piden y devuelve un extremo del canal de cada
+ * trabajador. Los trabajadores no heredan nada del proceso principal salvo lo que había
+ * al iniciar el servidor, así que reciben por su canal todo lo que necesitan
+ */
+
+#ifndef SERVIDOR_PROCESOS_H
+#define SERVIDOR_PROCESOS_H
+
+#include "../canal/canal.h"
+#include <sys/types.h> // Para pid_t
+
+void iniciarServidorProcesos(int (*trabajador)(Canal&));
+bool servidorProcesosIniciado();
+pair<Canal, pid_t> crearProcesoTrabajador();
+
+#endif
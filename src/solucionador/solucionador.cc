@@ -0,0 +1,185 @@
+#include "solucionador.h"
+
+namespace {
+
+/**
+ * @brief Opciones de lectura equivalentes a la configuración del contexto
+ */
+Opciones opcionesLectura(const ConfiguracionSolucionador& configuracion) {
+  Opciones opciones;
+  opciones.usarCache = configuracion.usarCache;
+  opciones.conDistancias = configuracion.conDistancias;
+  opciones.precision = configuracion.precision;
+  opciones.metrica = configuracion.metrica;
+  return opciones;
+}
+
+} // namespace
+
+/**
+ * @brief Constructor a partir de una instancia ya leída
+ * @param dato Instancia (el contexto pasa a ser su dueño)
+ * @param configuracion Configuración del contexto
+ * @details Si la instancia se leyó con otra precisión o métrica se rehacen sus distancias,
+ * y si se pide la matriz de distancias y no la trae se calcula aquí, una sola vez. Para
+ * repartir ramificación y poda entre procesos el servidor de procesos tiene que estar iniciado
+ */
+Solucionador::Solucionador(Dato dato, const ConfiguracionSolucionador& configuracion)
+  : configuracion_(configuracion), dato_(make_unique<Dato>(move(dato))) {
+  if (configuracion_.hilos == 0) {
+    throw invalid_argument("El número de hilos debe ser mayor que cero");
+  }
+  if (configuracion_.procesos > 1 && !servidorProcesosIniciado()) {
+    throw invalid_argument("Con varios procesos hay que llamar a iniciarServidorProcesos al principio del programa, antes de crear hilos");
+  }
+  const Distancias& distancias = dato_->distancias;
+  if (distancias.getNumPuntos() != dato_->numPuntos
+      || distancias.getPrecision() != configuracion_.precision
+      || distancias.getMetrica() != configuracion_.metrica) {
+    dato_->distancias = Distancias(dato_->espacioVectorial, configuracion_.precision, configuracion_.metrica);
+    dato_->matrizDistancias = MatrizDistancias();
+  }
+  if (configuracion_.conDistancias && dato_->matrizDistancias.vacia()) {
+    dato_->matrizDistancias.calcular(dato_->distancias);
+  }
+  preparar();
+}
+
+/**
+ * @brief Constructor a partir de un fichero de datos
+ * @param ruta Ruta del fichero
+ * @param configuracion Configuración del contexto
+ * @details Se lee como en el programa, usando la caché binaria si está activada
+ */
+Solucionador::Solucionador(const fs::path& ruta, const ConfiguracionSolucionador& configuracion)
+  : Solucionador(leerFichero(ruta, opcionesLectura(configuracion)), configuracion) {}
+
+/**
+ * @brief Método para crear el grupo de hilos y los algoritmos del contexto
+ * @return void
+ */
+void Solucionador::preparar() {
+  // Con un hilo las precomputaciones se hacen en el hilo que resuelve
+  if (configuracion_.hilos > 1) {
+    hilos_ = make_unique<GrupoHilos>(configuracion_.hilos);
+  }
+
+  voraz_ = make_unique<Voraz>();
+  voraz_->setDato(*dato_);
+  voraz_->setObjetivo(configuracion_.objetivo);
+
+  grasp_ = make_unique<Grasp>();
+  grasp_->setDato(*dato_);
+  grasp_->setObjetivo(configuracion_.objetivo);
+  grasp_->setMejoresPuntos(configuracion_.tamanioLRC);
+  if (configuracion_.semilla) grasp_->setSemilla(*configuracion_.semilla);
+
+  ramificacionPoda_ = make_unique<RamificacionPoda>();
+  ramificacionPoda_->setDato(*dato_);
+  ramificacionPoda_->setObjetivo(configuracion_.objetivo);
+  ramificacionPoda_->setLimiteMemoriaDistancias(configuracion_.memoriaDistancias);
+  ramificacionPoda_->setGrupoHilos(hilos_.get());
+  ramificacionPoda_->setProcesos(configuracion_.procesos, configuracion_.profundidadReparto);
+  ramificacionPoda_->setSemilla(configuracion_.semilla);
+}
+
+/**
+ * @brief Método para resolver la instancia
+ * @param m Número de puntos a seleccionar
+ * @param algoritmo Algoritmo a ejecutar
+ * @param presupuesto Límites de la ejecución (el voraz los ignora)
+ * @details Los algoritmos no acumulan resultados entre llamadas. Si el presupuesto detiene
+ * ramificación y poda, el resultado lo indica en interrumpido
+ * @return Resultado Resultado de la ejecución
+ */
+Resultado Solucionador::resolver(int m, TipoAlgoritmo algoritmo, const Presupuesto& presupuesto) {
+  Tarea<Resultado> tarea = resolverPorPasos(m, algoritmo, presupuesto, 0);
+  tarea.completar();
+  return tarea.obtener();
+}
+
+/**
+ * @brief Corrutina que resuelve la instancia por pasos
+ * @param m Número de puntos a seleccionar
+ * @param algoritmo Algoritmo a ejecutar
+ * @param presupuesto Límites de la ejecución (el voraz los ignora)
+ * @param tamanioPaso Nodos generados (ramificación y poda) o iteraciones (GRASP) entre
+ * dos pausas; 0 para no pausar. El voraz no se pausa
+ * @details Los parámetros se reciben por valor porque la corrutina los usa después de
+ * que el llamador vuelva. Destruir la tarea antes de que termine cancela la resolución.
+ * El pico de memoria solo se mide si la configuración lo pide y la resolución no se
+ * pausa (en las pausas se ejecutan otros trabajos del mismo proceso). Las resoluciones
+ * que se pausan son para el Planificador, así que exigen un contexto de un solo hilo
+ * @return Tarea<Resultado> Resolución pendiente
+ */
+Tarea<Resultado> Solucionador::resolverPorPasos(int m, TipoAlgoritmo algoritmo, Presupuesto presupuesto, size_t tamanioPaso) {
+  if (m < 2 || m > dato_->numPuntos) {
+    throw invalid_argument("El número de puntos a seleccionar debe estar entre 2 y " + to_string(dato_->numPuntos));
+  }
+  if (tamanioPaso > 0 && hilos_) {
+    throw invalid_argument("Una resolución por pasos (véase Planificador) necesita un contexto de un solo hilo");
+  }
+  const bool medirMemoria = configuracion_.medirMemoria && tamanioPaso == 0;
+  voraz_->setMedirMemoria(medirMemoria);
+  grasp_->setMedirMemoria(medirMemoria);
+  ramificacionPoda_->setMedirMemoria(medirMemoria);
+  switch (algoritmo) {
+    case TipoAlgoritmo::Voraz:
+      voraz_->setNumPuntosAlejados(m);
+      voraz_->ejecutar();
+      co_return move(voraz_->extraerResultados().back());
+    case TipoAlgoritmo::Grasp: {
+      grasp_->setNumPuntosAlejados(m);
+      Tarea<Resultado> iteraciones = resolverGrasp(presupuesto, tamanioPaso);
+      while (iteraciones.reanudar()) {
+        co_yield Pausa{};
+      }
+      co_return iteraciones.obtener();
+    }
+    case TipoAlgoritmo::RamificacionPoda: {
+      ramificacionPoda_->setNumPuntosAlejados(m);
+      ramificacionPoda_->setPresupuesto(presupuesto.tiempoMaximo, presupuesto.nodosMaximos);
+      Tarea<> busqueda = ramificacionPoda_->ejecutarPorPasos(tamanioPaso);
+      while (busqueda.reanudar()) {
+        co_yield Pausa{};
+      }
+      co_return move(ramificacionPoda_->extraerResultados().back());
+    }
+  }
+  throw invalid_argument("Algoritmo no válido");
+}
+
+/**
+ * @brief Corrutina que repite GRASP mientras quede presupuesto
+ * @param presupuesto Iteraciones y tiempo máximos (0 iteraciones para repetir hasta agotar el tiempo)
+ * @param iteracionesPorPaso Iteraciones entre dos pausas (0 para no pausar)
+ * @details El tiempo en pausa no cuenta en el presupuesto
+ * @return Tarea<Resultado> Mejor resultado, con el tiempo de todas las iteraciones
+ */
+Tarea<Resultado> Solucionador::resolverGrasp(Presupuesto presupuesto, size_t iteracionesPorPaso) {
+  if (presupuesto.iteraciones == 0 && presupuesto.tiempoMaximo <= 0.0) {
+    throw invalid_argument("GRASP sin límite de iteraciones necesita un tiempo máximo");
+  }
+  auto inicio = chrono::steady_clock::now();
+  Resultado mejor;
+  double tiempoCPU = 0.0;
+  for (size_t i = 0; presupuesto.iteraciones == 0 || i < presupuesto.iteraciones; ++i) {
+    if (i > 0 && presupuesto.tiempoMaximo > 0.0
+        && chrono::duration<double>(chrono::steady_clock::now() - inicio).count() >= presupuesto.tiempoMaximo) {
+      break;
+    }
+    grasp_->ejecutar();
+    Resultado resultado = move(grasp_->extraerResultados().back());
+    tiempoCPU += resultado.tiempoCPU;
+    if (i == 0 || resultado.z > mejor.z) {
+      mejor = move(resultado);
+    }
+    if (iteracionesPorPaso > 0 && (i + 1) % iteracionesPorPaso == 0) {
+      const auto pausa = chrono::steady_clock::now();
+      co_yield Pausa{};
+      inicio += chrono::steady_clock::now() - pausa;
+    }
+  }
+  mejor.tiempoCPU = tiempoCPU;
+  co_return mejor;
+}
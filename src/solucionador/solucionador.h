@@ -0,0 +1,81 @@
+/**
+ * @class Contexto para resolver una instancia desde otro programa
+ * @details Se crea una vez por instancia y es dueño de los datos, de las precomputaciones
+ * (matriz de distancias, caché de distancias y vecinos de ramificación y poda) y del
+ * grupo de hilos, que se reutilizan en todas las llamadas a resolver. Los resultados
+ * apuntan a la instancia del contexto, así que solo son válidos mientras este exista.
+ * Un contexto no admite llamadas concurrentes; para resolver en paralelo se usa un
+ * contexto por hilo. resolverPorPasos devuelve la resolución como una tarea reanudable
+ * (véase Planificador); el contexto no se puede mover ni destruir mientras esté pendiente.
+ * El pico de memoria solo se mide si se pide en la configuración, porque su reinicio es
+ * de todo el proceso y no sirve con varias resoluciones a la vez
+ */
+
+#ifndef SOLUCIONADOR_H
+#define SOLUCIONADOR_H
+
+#include "../funciones-main/funciones-main.h"
+#include "../tarea/tarea.h"
+
+// Algoritmos disponibles
+enum class TipoAlgoritmo {
+  Voraz,
+  Grasp,
+  RamificacionPoda
+};
+
+// Configuración fija del contexto
+struct ConfiguracionSolucionador {
+  Precision precision = Precision::Doble; // Precisión de las tablas de distancias (los puntos siguen en doble)
+  Metrica metrica = Metrica::Euclidea; // Métrica de las distancias entre puntos
+  TipoObjetivo objetivo = TipoObjetivo::Suma; // Función objetivo que se maximiza
+  bool conDistancias = false; // Si se precalcula la matriz de distancias
+  bool usarCache = true; // Si se usa la caché binaria al leer un fichero
+  size_t memoriaDistancias = size_t(256) << 20; // Memoria máxima de la caché de distancias de ramificación y poda
+  size_t hilos = 1; // Hilos para las fases paralelas (1 para no crear ninguno, como exige el Planificador)
+  size_t procesos = 1; // Procesos trabajadores de ramificación y poda (1 para no repartir; más exige iniciarServidorProcesos al principio del programa)
+  int profundidadReparto = 2; // Nivel de los subárboles que se reparten entre los procesos
+  int tamanioLRC = 2; // Tamaño de la lista restringida de candidatos de GRASP
+  optional<uint32_t> semilla; // Semilla de GRASP (aleatoria si no se indica)
+  bool medirMemoria = false; // Si cada resolución reinicia y mide el pico de memoria del proceso (solo válido sin otras resoluciones a la vez)
+};
+
+// Límites de una llamada a resolver (0 sin límite)
+struct Presupuesto {
+  double tiempoMaximo = 0.0; // Segundos de búsqueda de ramificación y poda o de iteraciones de GRASP
+  size_t nodosMaximos = 0; // Nodos generados por ramificación y poda
+  size_t iteraciones = 1; // Construcciones de GRASP (se devuelve la mejor)
+};
+
+class Solucionador {
+  public:
+    // Constructores
+    Solucionador(Dato dato, const ConfiguracionSolucionador& configuracion = {});
+    Solucionador(const fs::path& ruta, const ConfiguracionSolucionador& configuracion = {});
+
+    Solucionador(const Solucionador&) = delete;
+    Solucionador& operator=(const Solucionador&) = delete;
+    Solucionador(Solucionador&&) = default;
+    Solucionador& operator=(Solucionador&&) = default;
+
+    // Métodos de la clase
+    Resultado resolver(int m, TipoAlgoritmo algoritmo, const Presupuesto& presupuesto = {});
+    Tarea<Resultado> resolverPorPasos(int m, TipoAlgoritmo algoritmo, Presupuesto presupuesto, size_t tamanioPaso);
+
+    // Getters
+    inline const Dato& getDato() const { return *dato_; }
+    inline const ConfiguracionSolucionador& getConfiguracion() const { return configuracion_; }
+
+  private:
+    void preparar();
+    Tarea<Resultado> resolverGrasp(Presupuesto presupuesto, size_t iteracionesPorPaso);
+
+    ConfiguracionSolucionador configuracion_; // Configuración del contexto
+    unique_ptr<Dato> dato_; // Instancia (en el montón para que su dirección no cambie al mover el contexto)
+    unique_ptr<GrupoHilos> hilos_; // Hilos para las precomputaciones (nulo con un solo hilo)
+    unique_ptr<Voraz> voraz_; // Algoritmos, creados una vez y reutilizados
+    unique_ptr<Grasp> grasp_;
+    unique_ptr<RamificacionPoda> ramificacionPoda_;
+};
+
+#endif
@@ -0,0 +1,222 @@
+#include "sumidero.h"
+#include <cstdio> // Para snprintf
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Escapa una cadena para incluirla en JSON
+ * @details Los caracteres de control sin escape corto se escriben como \u00XX
+ */
+string escaparJSON(const string& cadena) {
+  string escapada;
+  for (char c : cadena) {
+    switch (c) {
+      case '"': escapada += "\\\""; break;
+      case '\\': escapada += "\\\\"; break;
+      case '\n': escapada += "\\n"; break;
+      case '\r': escapada += "\\r"; break;
+      case '\t': escapada += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char codigo[7];
+          snprintf(codigo, sizeof(codigo), "\\u%04x", static_cast<unsigned char>(c));
+          escapada += codigo;
+        } else {
+          escapada += c;
+        }
+    }
+  }
+  return escapada;
+}
+
+/**
+ * @brief Escapa un campo para incluirlo en CSV (RFC 4180)
+ * @details Si contiene comas, comillas o saltos de línea se entrecomilla y sus comillas se duplican
+ */
+string escaparCSV(const string& campo) {
+  if (campo.find_first_of(",\"\r\n") == string::npos) return campo;
+  string escapado = "\"";
+  for (char c : campo) {
+    if (c == '"') escapado += '"';
+    escapado += c;
+  }
+  return escapado + '"';
+}
+
+/**
+ * @brief Obtiene los identificadores de los puntos seleccionados
+ */
+vector<int> identificadores(const Resultado& resultado) {
+  vector<int> ids;
+  for (const auto& indice : resultado.seleccion) {
+    ids.push_back(resultado.dato->espacioVectorial[indice].getIndice());
+  }
+  return ids;
+}
+
+/**
+ * @brief Muestra la selección con el formato {a, b, c}
+ */
+string seleccionTexto(const Resultado& resultado) {
+  vector<int> ids = identificadores(resultado);
+  string texto = "{";
+  for (size_t i = 0; i < ids.size(); ++i) {
+    if (i > 0) texto += ", ";
+    texto += to_string(ids[i]);
+  }
+  return texto + "}";
+}
+
+} // namespace
+
+/**
+ * @brief Método para registrar un bloque de resultados
+ * @param resultados Resultados a registrar
+ * @details El bloque se formatea por completo antes de escribirlo de una vez
+ * @return void
+ */
+void Sumidero::registrar(const vector<Resultado>& resultados) {
+  if (resultados.empty()) return;
+  lock_guard<mutex> bloqueo(cerrojo_);
+  ostringstream os;
+  formatear(os, resultados);
+  salida_ << os.str() << flush;
+}
+
+/**
+ * @brief Método para formatear los resultados como una tabla de texto
+ * @param os Flujo donde se formatea
+ * @param resultados Resultados a formatear
+ * @details Las columnas |LRC| y Nodos generados solo se muestran para los algoritmos que las usan.
+ * La memoria es el pico de memoria residente del proceso durante la ejecución, en MB
+ * @return void
+ */
+void SumideroTabla::formatear(ostringstream& os, const vector<Resultado>& resultados) {
+  const bool conLRC = resultados.front().tamanioLRC > 0;
+  const bool conNodos = resultados.front().algoritmo == "RamificacionPoda";
+  const string separador(80 + (conLRC ? 11 : 0) + (conNodos ? 15 : 0), '-');
+
+  if (!cabeceraMostrada_) {
+    // Cabecera
+    os << separador << endl;
+    os << left 
+    << setw(20) << "Problema" 
+    << setw(6) << "n" 
+    << setw(6) << "K" 
+    << setw(6) << "m";
+    if (conLRC) os << setw(10) << "|LRC|";
+    os << setw(12) << "z"
+    << setw(12) << "Tiempo CPU"
+    << setw(14) << "Memoria (MB)";
+    if (conNodos) os << setw(18) << "Nodos generados";
+    os << setw(conLRC ? 6 : 12) << "S"
+    << endl;
+    os << separador << endl;
+    cabeceraMostrada_ = true;
+  }
+
+  // Muestro los resultados
+  for (const auto& resultado : resultados) {
+    os << left 
+    << setw(20) << resultado.dato->nombreFichero
+    << setw(6) << resultado.dato->numPuntos
+    << setw(6) << resultado.dato->tamanio
+    << setw(6) << resultado.numPuntosAlejados;
+    if (conLRC) os << setw(10) << resultado.tamanioLRC;
+    os << setw(12) << fixed << setprecision(2) << resultado.z
+    << setw(12) << fixed << setprecision(5) << resultado.tiempoCPU
+    << setw(14) << setprecision(1) << resultado.memoriaMaxima / 1048576.0;
+    if (conNodos) os << setw(18) << resultado.nodosGenerados;
+    os << setw(0) << seleccionTexto(resultado)
+    << endl;
+  }
+  os << separador << endl;
+}
+
+/**
+ * @brief Método para formatear los resultados en CSV
+ * @param os Flujo donde se formatea
+ * @param resultados Resultados a formatear
+ * @details La selección se escribe con los identificadores separados por espacios
+ * @return void
+ */
+void SumideroCSV::formatear(ostringstream& os, const vector<Resultado>& resultados) {
+  if (!cabeceraMostrada_) {
+    os << "algoritmo,objetivo,metrica,problema,n,K,m,LRC,z,tiempoCPU,memoriaMaxima,memoriaTablas,memoriaAbiertos,nodosAbiertosMaximos,nodosGenerados,nodosPodados,puntosEliminados,S" << endl;
+    cabeceraMostrada_ = true;
+  }
+  for (const auto& resultado : resultados) {
+    vector<int> ids = identificadores(resultado);
+    os << resultado.algoritmo << ','
+    << nombreObjetivo(resultado.objetivo) << ','
+    << nombreMetrica(resultado.dato->distancias.getMetrica()) << ','
+    << escaparCSV(resultado.dato->nombreFichero) << ','
+    << resultado.dato->numPuntos << ','
+    << resultado.dato->tamanio << ','
+    << resultado.numPuntosAlejados << ','
+    << resultado.tamanioLRC << ','
+    << setprecision(17) << resultado.z << ','
+    << resultado.tiempoCPU << ','
+    << resultado.memoriaMaxima << ','
+    << resultado.memoriaTablas << ','
+    << resultado.memoriaAbiertos << ','
+    << resultado.nodosAbiertosMaximos << ','
+    << resultado.nodosGenerados << ','
+    << resultado.nodosPodados << ','
+    << resultado.puntosEliminados << ',';
+    for (size_t i = 0; i < ids.size(); ++i) {
+      if (i > 0) os << ' ';
+      os << ids[i];
+    }
+    os << endl;
+  }
+}
+
+/**
+ * @brief Método para formatear los resultados en JSON (un objeto por línea)
+ * @param os Flujo donde se formatea
+ * @param resultados Resultados a formatear
+ * @return void
+ */
+void SumideroJSON::formatear(ostringstream& os, const vector<Resultado>& resultados) {
+  for (const auto& resultado : resultados) {
+    os << "{\"algoritmo\":\"" << escaparJSON(resultado.algoritmo) << '"'
+    << ",\"objetivo\":\"" << nombreObjetivo(resultado.objetivo) << '"'
+    << ",\"metrica\":\"" << nombreMetrica(resultado.dato->distancias.getMetrica()) << '"'
+    << ",\"problema\":\"" << escaparJSON(resultado.dato->nombreFichero) << '"'
+    << ",\"n\":" << resultado.dato->numPuntos
+    << ",\"K\":" << resultado.dato->tamanio
+    << ",\"m\":" << resultado.numPuntosAlejados
+    << ",\"LRC\":" << resultado.tamanioLRC
+    << ",\"z\":" << setprecision(17) << resultado.z
+    << ",\"tiempoCPU\":" << resultado.tiempoCPU
+    << ",\"memoriaMaxima\":" << resultado.memoriaMaxima
+    << ",\"memoriaTablas\":" << resultado.memoriaTablas
+    << ",\"memoriaAbiertos\":" << resultado.memoriaAbiertos
+    << ",\"nodosAbiertosMaximos\":" << resultado.nodosAbiertosMaximos
+    << ",\"nodosGenerados\":" << resultado.nodosGenerados
+    << ",\"nodosPodados\":" << resultado.nodosPodados
+    << ",\"puntosEliminados\":" << resultado.puntosEliminados
+    << ",\"S\":[";
+    vector<int> ids = identificadores(resultado);
+    for (size_t i = 0; i < ids.size(); ++i) {
+      if (i > 0) os << ',';
+      os << ids[i];
+    }
+    os << "]}" << endl;
+  }
+}
+
+/**
+ * @brief Función para crear el sumidero de un formato
+ * @param formato Formato de salida (tabla, csv o json)
+ * @param salida Flujo donde se escriben los resultados
+ * @return unique_ptr<Sumidero> Sumidero creado
+ */
+unique_ptr<Sumidero> crearSumidero(const string& formato, ostream& salida) {
+  if (formato == "tabla") return make_unique<SumideroTabla>(salida);
+  if (formato == "csv") return make_unique<SumideroCSV>(salida);
+  if (formato == "json") return make_unique<SumideroJSON>(salida);
+  throw invalid_argument("Formato de salida no válido: " + formato);
+}
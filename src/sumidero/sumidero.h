@@ -0,0 +1,71 @@
+/**
+ * @class Clases para volcar los resultados de los algoritmos
+ * @details Cada llamada a registrar escribe un bloque de resultados completo bajo un
+ * cerrojo, por lo que varios hilos pueden compartir el mismo sumidero
+ */
+
+#ifndef SUMIDERO_H
+#define SUMIDERO_H
+
+#include "../resultado/resultado.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+class Sumidero {
+  public:
+    // Constructor
+    Sumidero(ostream& salida) : salida_(salida) {}
+
+    // Destructor
+    virtual ~Sumidero() {}
+
+    // Métodos de la clase
+    void registrar(const vector<Resultado>& resultados);
+
+  protected:
+    virtual void formatear(ostringstream& os, const vector<Resultado>& resultados) = 0;
+
+  private:
+    ostream& salida_;
+    mutex cerrojo_;
+};
+
+// Tabla de texto alineada con setw
+class SumideroTabla : public Sumidero {
+  public:
+    SumideroTabla(ostream& salida) : Sumidero(salida) {}
+
+  protected:
+    void formatear(ostringstream& os, const vector<Resultado>& resultados) override;
+
+  private:
+    bool cabeceraMostrada_ = false;
+};
+
+// Valores separados por comas con una cabecera
+class SumideroCSV : public Sumidero {
+  public:
+    SumideroCSV(ostream& salida) : Sumidero(salida) {}
+
+  protected:
+    void formatear(ostringstream& os, const vector<Resultado>& resultados) override;
+
+  private:
+    bool cabeceraMostrada_ = false;
+};
+
+// Un objeto JSON por línea
+class SumideroJSON : public Sumidero {
+  public:
+    SumideroJSON(ostream& salida) : Sumidero(salida) {}
+
+  protected:
+    void formatear(ostringstream& os, const vector<Resultado>& resultados) override;
+};
+
+unique_ptr<Sumidero> crearSumidero(const string& formato, ostream& salida);
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @class Corrutina reanudable para ejecutar los algoritmos por pasos
+ * @details La corrutina empieza suspendida y cada llamada a reanudar la ejecuta hasta
+ * el siguiente co_yield Pausa{} o hasta que termina con co_return. Si la corrutina lanza
+ * una excepción, reanudar la relanza. Destruir una tarea sin terminar la cancela: se
+ * destruye su marco y con él sus variables locales. Una tarea no se puede reanudar desde
+ * dos hilos a la vez, pero sí desde hilos distintos en momentos distintos
+ */
+
+#ifndef TAREA_H
+#define TAREA_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+// Valor que se cede para suspender la tarea
+struct Pausa {};
+
+namespace detalle {
+
+// Valor devuelto por la corrutina con co_return
+template <class T>
+struct PromesaValor {
+  optional<T> valor_;
+  void return_value(T valor) { valor_ = move(valor); }
+};
+
+// Corrutinas sin valor
+template <>
+struct PromesaValor<void> {
+  void return_void() {}
+};
+
+} // namespace detalle
+
+template <class T = void>
+class Tarea {
+  public:
+    struct promise_type : detalle::PromesaValor<T> {
+      exception_ptr error_; // Excepción de la corrutina (se relanza al reanudar)
+
+      Tarea get_return_object() { return Tarea(coroutine_handle<promise_type>::from_promise(*this)); }
+      suspend_always initial_suspend() noexcept { return {}; }
+      suspend_always final_suspend() noexcept { return {}; }
+      suspend_always yield_value(Pausa) noexcept { return {}; }
+      void unhandled_exception() { error_ = current_exception(); }
+    };
+
+    // Constructores
+    Tarea() = default;
+    Tarea(Tarea&& otra) noexcept : corrutina_(exchange(otra.corrutina_, nullptr)) {}
+    Tarea& operator=(Tarea&& otra) noexcept {
+      if (this != &otra) {
+        destruir();
+        corrutina_ = exchange(otra.corrutina_, nullptr);
+      }
+      return *this;
+    }
+    Tarea(const Tarea&) = delete;
+    Tarea& operator=(const Tarea&) = delete;
+
+    // Destructor (cancela la tarea si no ha terminado)
+    ~Tarea() { destruir(); }
+
+    /**
+     * @brief Ejecuta la tarea hasta su siguiente pausa
+     * @return true si queda trabajo, false si ha terminado
+     */
+    bool reanudar() {
+      if (terminada()) return false;
+      corrutina_.resume();
+      if (corrutina_.promise().error_) {
+        rethrow_exception(exchange(corrutina_.promise().error_, nullptr));
+      }
+      return !corrutina_.done();
+    }
+
+    /**
+     * @brief Ejecuta la tarea hasta que termina
+     */
+    void completar() {
+      while (reanudar()) {}
+    }
+
+    /**
+     * @brief Valor devuelto por la tarea (solo si ha terminado y T no es void)
+     */
+    template <class U = T>
+    U obtener() {
+      if (!corrutina_ || !corrutina_.done() || !corrutina_.promise().valor_) {
+        throw logic_error("La tarea no ha terminado");
+      }
+      return move(*corrutina_.promise().valor_);
+    }
+
+    inline bool terminada() const { return !corrutina_ || corrutina_.done(); }
+
+  private:
+    explicit Tarea(coroutine_handle<promise_type> corrutina) : corrutina_(corrutina) {}
+
+    void destruir() {
+      if (corrutina_) {
+        corrutina_.destroy();
+        corrutina_ = nullptr;
+      }
+    }
+
+    coroutine_handle<promise_type> corrutina_ = nullptr; // Marco de la corrutina (nulo si no hay tarea)
+};
+
+#endif
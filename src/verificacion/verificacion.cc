@@ -0,0 +1,350 @@
+#include "verificacion.h"
+#include <cmath>
+
+namespace {
+
+constexpr int kMaxPuntos = 5; // Mayor m que se verifica (el mismo que resuelve el menú)
+constexpr double kMaxCombinaciones = 2e7; // Combinaciones máximas que se enumeran por fuerza bruta
+// Los tiempos se comparan por instancia (la suma de todos sus m), y solo si la referencia
+// llega a kTiempoMinimo: un caso de ramificación y poda dura entre 1e-5 y 1e-2 s, y una
+// sola expropiación del planificador del sistema (varios ms en una máquina cargada)
+// puede duplicarlo, así que por debajo de ese umbral el tiempo mide el ruido y no el
+// código. kHolguraTiempo cubre esas expropiaciones (se han visto excesos de 13 ms en
+// casos de 8 ms sin cambiar el código) además de la tolerancia relativa
+constexpr double kTiempoMinimo = 0.05; // Segundos de referencia por instancia a partir de los que se compara el tiempo
+constexpr double kHolguraTiempo = 0.02; // Segundos que se toleran además de la tolerancia relativa
+constexpr uint32_t kSemilla = 1; // Semilla de GRASP si no se indica otra
+constexpr int kRepeticionesTiempo = 3; // Ejecuciones de ramificación y poda por caso (se toma el menor tiempo)
+#ifdef NDEBUG
+constexpr bool kCompilacionRelease = true; // Si los tiempos son comparables con las referencias (make CONFIG=release)
+#else
+constexpr bool kCompilacionRelease = false;
+#endif
+
+/**
+ * @brief Número de combinaciones de n elementos tomados de m en m
+ * @details En coma flotante, solo se usa para decidir si se enumeran
+ */
+double combinaciones(size_t n, size_t m) {
+  double total = 1.0;
+  for (size_t i = 0; i < m; ++i) {
+    total = total * (n - i) / (i + 1);
+  }
+  return total;
+}
+
+/**
+ * @brief Indica si un valor supera al óptimo más allá del error de redondeo
+ */
+bool superaOptimo(double valor, double optimo) {
+  return valor > optimo + 1e-6 * max(1.0, fabs(optimo));
+}
+
+/**
+ * @brief Enumera todas las selecciones de m puntos y guarda el mejor valor
+ * @details El valor se acumula con los ganchos de la política al añadir cada punto
+ */
+template <class Objetivo>
+void enumerar(const vector<double>& distancias, size_t n, size_t m, vector<int>& seleccion,
+              size_t desde, double valor, double& optimo) {
+  if (seleccion.size() == m) {
+    optimo = max(optimo, Objetivo::final(valor, m));
+    return;
+  }
+  for (size_t j = desde; j + (m - seleccion.size()) <= n; ++j) {
+    double suma = 0.0;
+    double minimo = numeric_limits<double>::infinity();
+    for (int i : seleccion) {
+      const double distancia = distancias[i * n + j];
+      suma += distancia;
+      minimo = min(minimo, distancia);
+    }
+    seleccion.push_back(j);
+    enumerar<Objetivo>(distancias, n, m, seleccion, j + 1, Objetivo::anadir(valor, suma, minimo), optimo);
+    seleccion.pop_back();
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Función para construir la clave de una referencia
+ * @param problema Nombre del fichero de la instancia
+ * @param objetivo Función objetivo
+ * @param metrica Métrica de las distancias
+ * @param m Número de puntos seleccionados
+ * @return string Clave con los campos separados por comas (como en el fichero)
+ */
+string claveLineaBase(const string& problema, TipoObjetivo objetivo, Metrica metrica, int m) {
+  return problema + ',' + nombreObjetivo(objetivo) + ',' + nombreMetrica(metrica) + ',' + to_string(m);
+}
+
+/**
+ * @brief Función para leer las referencias de rendimiento
+ * @param ruta Fichero CSV con las columnas problema,objetivo,metrica,m,nodosGenerados,tiempoCPU
+ * @details Las líneas que empiezan por # y la cabecera se ignoran. Si el fichero
+ * no existe no hay referencias
+ * @return LineasBase Referencias leídas
+ */
+LineasBase leerLineasBase(const string& ruta) {
+  LineasBase lineas;
+  ifstream fichero(ruta);
+  string linea;
+  while (getline(fichero, linea)) {
+    if (linea.empty() || linea[0] == '#' || linea.rfind("problema,", 0) == 0) continue;
+    // Los cuatro primeros campos forman la clave
+    size_t coma = string::npos;
+    for (int campo = 0; campo < 4; ++campo) {
+      coma = linea.find(',', coma + 1);
+      if (coma == string::npos) break;
+    }
+    const size_t ultima = linea.rfind(',');
+    if (coma == string::npos || ultima <= coma) {
+      throw runtime_error("Referencia no válida en " + ruta + ": " + linea);
+    }
+    LineaBase referencia;
+    referencia.nodosGenerados = stoull(linea.substr(coma + 1, ultima - coma - 1));
+    referencia.tiempoCPU = stod(linea.substr(ultima + 1));
+    lineas[linea.substr(0, coma)] = referencia;
+  }
+  return lineas;
+}
+
+/**
+ * @brief Función para guardar las referencias de rendimiento
+ * @param ruta Fichero CSV donde se guardan (se crea su directorio si no existe)
+ * @param lineas Referencias a guardar
+ * @return void
+ */
+void guardarLineasBase(const string& ruta, const LineasBase& lineas) {
+  const fs::path directorio = fs::path(ruta).parent_path();
+  if (!directorio.empty()) {
+    fs::create_directories(directorio);
+  }
+  ofstream fichero(ruta, ios::trunc);
+  if (!fichero) {
+    throw runtime_error("No se pueden guardar las referencias en " + ruta);
+  }
+  fichero << "# Referencias de ramificación y poda (make CONFIG=release; ./programa data --verificar --actualizar-referencias)" << endl;
+  fichero << "problema,objetivo,metrica,m,nodosGenerados,tiempoCPU" << endl;
+  for (const auto& [clave, referencia] : lineas) {
+    fichero << clave << ',' << referencia.nodosGenerados << ','
+    << setprecision(6) << referencia.tiempoCPU << endl;
+  }
+}
+
+/**
+ * @brief Función para calcular el óptimo de una instancia por fuerza bruta
+ * @param dato Instancia
+ * @param m Número de puntos a seleccionar
+ * @param objetivo Función objetivo
+ * @details Usa las distancias exactas en doble precisión con la métrica de la instancia,
+ * igual que el valor z de los resultados
+ * @return double Valor óptimo
+ */
+double calcularOptimoFuerzaBruta(const Dato& dato, int m, TipoObjetivo objetivo) {
+  const EspacioVectorial& espacio = dato.espacioVectorial;
+  const Metrica metrica = dato.distancias.getMetrica();
+  const size_t n = espacio.getDimension();
+  vector<double> distancias(n * n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      distancias[i * n + j] = espacio[i].calcularDistancia(espacio[j], metrica);
+    }
+  }
+  double optimo = -numeric_limits<double>::infinity();
+  vector<int> seleccion;
+  seleccion.reserve(m);
+  conObjetivo(objetivo, [&](auto politica) {
+    using Objetivo = decltype(politica);
+    enumerar<Objetivo>(distancias, n, m, seleccion, 0, Objetivo::inicial(), optimo);
+  });
+  return optimo;
+}
+
+/**
+ * @brief Función para verificar los algoritmos sobre los ficheros de un directorio
+ * @param opciones Opciones de la línea de comandos
+ * @details Para cada instancia y m = 2..5 ejecuta el voraz, GRASP (|LRC| 2 y 3) y
+ * ramificación y poda con las opciones indicadas. GRASP usa una semilla fija para
+ * que los nodos generados sean reproducibles, y el tiempo de ramificación y poda es
+ * el menor de kRepeticionesTiempo ejecuciones. El tiempo se compara con la referencia
+ * sumado por instancia, en una fila propia, y solo si la suma de las referencias llega
+ * a kTiempoMinimo. Con --actualizar-referencias se
+ * guardan las medidas como nuevas referencias en lugar de compararlas. Las referencias
+ * son de la compilación release con un proceso: los tiempos solo se comparan (y las
+ * referencias solo se actualizan) en release, y con varios procesos no se compara el
+ * rendimiento, porque los nodos generados dependen del reparto. Las instancias se leen
+ * sin la caché binaria
+ * @return int 0 si todas las comprobaciones pasan, 1 si alguna falla
+ */
+int verificar(const Opciones& opciones) {
+  if (opciones.actualizarReferencias && (!kCompilacionRelease || opciones.procesos > 1)) {
+    throw invalid_argument("Las referencias solo se actualizan con la compilación release (make CONFIG=release) y un proceso");
+  }
+  const bool compararNodos = opciones.procesos == 1;
+  const bool compararTiempo = compararNodos && kCompilacionRelease;
+  if (!compararNodos) {
+    cerr << "Aviso: con varios procesos no se compara el rendimiento con las referencias" << endl;
+  } else if (!compararTiempo) {
+    cerr << "Aviso: compilación sin optimizar; los tiempos no se comparan con las referencias, medidas con make CONFIG=release" << endl;
+  }
+  const uint32_t semilla = opciones.semilla.value_or(kSemilla);
+
+  // Las instancias se leen siempre del texto, sin la caché binaria: la verificación no
+  // escribe en su directorio de datos ni mide la lectura proyectada de una ejecución anterior
+  Opciones opcionesLectura = opciones;
+  opcionesLectura.usarCache = false;
+  LineasBase referencias = leerLineasBase(opciones.referencias);
+  GrupoHilos hilos(opciones.hilos);
+  size_t comprobadas = 0, fallidas = 0, sinReferencia = 0, tiemposSinComparar = 0;
+  const string separador(122, '-');
+
+  cout << separador << endl;
+  cout << left
+  << setw(20) << "Problema"
+  << setw(4) << "m"
+  << setw(13) << "Óptimo" // setw cuenta bytes y Ó ocupa dos
+  << setw(12) << "Voraz"
+  << setw(12) << "GRASP"
+  << setw(12) << "RyP"
+  << setw(12) << "Nodos"
+  << setw(12) << "Ref. nodos"
+  << setw(12) << "Tiempo CPU"
+  << setw(12) << "Ref. tiempo"
+  << "Estado" << endl;
+  cout << separador << endl;
+
+  for (const auto& ruta : listarFicheros(opciones.directorio)) {
+    Dato dato = leerFichero(ruta, opcionesLectura);
+    auto voraz = make_unique<Voraz>();
+    voraz->setDato(dato);
+    voraz->setObjetivo(opciones.objetivo);
+    auto grasp = make_unique<Grasp>();
+    grasp->setDato(dato);
+    grasp->setObjetivo(opciones.objetivo);
+    grasp->setSemilla(semilla);
+    auto ramificacionPoda = make_unique<RamificacionPoda>();
+    ramificacionPoda->setDato(dato);
+    ramificacionPoda->setObjetivo(opciones.objetivo);
+    ramificacionPoda->setLimiteMemoriaDistancias(opciones.memoriaDistancias);
+    ramificacionPoda->setGrupoHilos(&hilos);
+    ramificacionPoda->setProcesos(opciones.procesos, opciones.profundidadReparto);
+    ramificacionPoda->setSemilla(semilla);
+
+    const int maxPuntos = min(kMaxPuntos, dato.numPuntos);
+    double tiempoInstancia = 0.0, referenciaInstancia = 0.0;
+    bool referenciasCompletas = !opciones.actualizarReferencias;
+    for (int m = 2; m <= maxPuntos; ++m) {
+      vector<string> errores;
+      voraz->setNumPuntosAlejados(m);
+      voraz->ejecutar();
+      const double zVoraz = voraz->getResultados().back().z;
+      grasp->setNumPuntosAlejados(m);
+      double zGrasp = -numeric_limits<double>::infinity();
+      for (int k = 2; k <= 3; ++k) {
+        grasp->setMejoresPuntos(k);
+        grasp->ejecutar();
+        zGrasp = max(zGrasp, grasp->getResultados().back().z);
+      }
+      ramificacionPoda->setNumPuntosAlejados(m);
+      // Con la semilla fija las repeticiones generan los mismos nodos; el menor tiempo
+      // descarta las interrupciones del sistema en los casos de pocos milisegundos
+      ramificacionPoda->ejecutar();
+      Resultado resultado = move(ramificacionPoda->extraerResultados().back());
+      for (int repeticion = 1; repeticion < kRepeticionesTiempo; ++repeticion) {
+        ramificacionPoda->ejecutar();
+        resultado.tiempoCPU = min(resultado.tiempoCPU, ramificacionPoda->extraerResultados().back().tiempoCPU);
+      }
+
+      // Óptimo por fuerza bruta si la enumeración es abordable; si no, el de ramificación y poda
+      const bool fuerzaBruta = combinaciones(dato.numPuntos, m) <= kMaxCombinaciones;
+      const double optimo = fuerzaBruta ? calcularOptimoFuerzaBruta(dato, m, opciones.objetivo) : resultado.z;
+      if (fuerzaBruta && (superaOptimo(optimo, resultado.z) || superaOptimo(resultado.z, optimo))) {
+        errores.push_back("ramificación y poda no alcanza el óptimo");
+      }
+      if (superaOptimo(zVoraz, optimo)) {
+        errores.push_back("el voraz supera el óptimo");
+      }
+      if (superaOptimo(zGrasp, optimo)) {
+        errores.push_back("GRASP supera el óptimo");
+      }
+
+      // Rendimiento frente a la referencia
+      const string clave = claveLineaBase(dato.nombreFichero, opciones.objetivo, dato.distancias.getMetrica(), m);
+      auto referencia = referencias.find(clave);
+      const bool conReferencia = referencia != referencias.end() && !opciones.actualizarReferencias;
+      if (conReferencia) {
+        const LineaBase& base = referencia->second;
+        if (compararNodos && resultado.nodosGenerados > base.nodosGenerados * (1.0 + opciones.tolerancia)) {
+          errores.push_back("nodos generados por encima de la referencia");
+        }
+        referenciaInstancia += base.tiempoCPU;
+      } else if (!opciones.actualizarReferencias) {
+        sinReferencia++;
+        referenciasCompletas = false;
+      }
+      tiempoInstancia += resultado.tiempoCPU;
+      if (opciones.actualizarReferencias) {
+        referencias[clave] = {resultado.nodosGenerados, resultado.tiempoCPU};
+      }
+
+      comprobadas++;
+      if (!errores.empty()) fallidas++;
+      cout << left
+      << setw(20) << dato.nombreFichero
+      << setw(4) << m
+      << setw(12) << fixed << setprecision(2) << optimo
+      << setw(12) << zVoraz
+      << setw(12) << zGrasp
+      << setw(12) << resultado.z
+      << setw(12) << resultado.nodosGenerados
+      << setw(12) << (conReferencia ? to_string(referencia->second.nodosGenerados) : "-")
+      << setw(12) << setprecision(5) << resultado.tiempoCPU;
+      if (conReferencia) {
+        cout << setw(12) << referencia->second.tiempoCPU;
+      } else {
+        cout << setw(12) << "-";
+      }
+      cout << (errores.empty() ? "OK" : "FALLO") << (fuerzaBruta ? "" : " (sin fuerza bruta)") << endl;
+      for (const auto& error : errores) {
+        cout << "  - " << error << endl;
+      }
+    }
+
+    // Tiempo de la instancia frente a la suma de sus referencias
+    if (compararTiempo && referenciasCompletas) {
+      if (referenciaInstancia < kTiempoMinimo) {
+        tiemposSinComparar++;
+      } else {
+        const bool correcto = tiempoInstancia <= referenciaInstancia * (1.0 + opciones.tolerancia) + kHolguraTiempo;
+        comprobadas++;
+        if (!correcto) fallidas++;
+        cout << left
+        << setw(20) << dato.nombreFichero
+        << setw(4) << "*"
+        << setw(12 * 6) << ""
+        << setw(12) << fixed << setprecision(5) << tiempoInstancia
+        << setw(12) << referenciaInstancia
+        << (correcto ? "OK" : "FALLO") << endl;
+        if (!correcto) {
+          cout << "  - tiempo de CPU de la instancia por encima de la referencia" << endl;
+        }
+      }
+    }
+  }
+  cout << separador << endl;
+
+  if (opciones.actualizarReferencias) {
+    guardarLineasBase(opciones.referencias, referencias);
+    cout << "Referencias guardadas en " << opciones.referencias << endl;
+  } else if (sinReferencia > 0) {
+    cerr << "Aviso: " << sinReferencia << " casos sin referencia en " << opciones.referencias << endl;
+  }
+  if (tiemposSinComparar > 0) {
+    cout << "Tiempo sin comparar en " << tiemposSinComparar << " instancias (referencia por debajo de "
+    << setprecision(2) << kTiempoMinimo << " s, donde domina el ruido del sistema)" << endl;
+  }
+  cout << comprobadas - fallidas << " de " << comprobadas << " casos verificados correctamente." << endl;
+  return fallidas > 0 ? 1 : 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @brief Verificación de optimalidad y rendimiento de los algoritmos
+ * @details Para cada instancia y cada m comprueba que:
+ *  - ramificación y poda alcanza el óptimo calculado por fuerza bruta
+ *  - ni el voraz ni GRASP superan ese óptimo
+ *  - los nodos generados y el tiempo de ramificación y poda no superan sus
+ *    referencias guardadas en más de la tolerancia (el tiempo solo en la compilación
+ *    release, con la que se midieron las referencias: make verificar)
+ * El tiempo se compara sumado por instancia y solo si su referencia llega a 50 ms, con
+ * 20 ms de holgura: los casos duran de 1e-5 a 1e-2 s y una expropiación del planificador
+ * del sistema basta para duplicarlos, así que por debajo de eso la comparación solo
+ * mediría ruido (los nodos generados, que no dependen de la máquina, sí se comparan siempre)
+ */
+
+#ifndef VERIFICACION_H
+#define VERIFICACION_H
+
+#include "../funciones-main/funciones-main.h"
+#include <map>
+
+// Medidas de referencia de ramificación y poda para una instancia y un m
+struct LineaBase {
+  size_t nodosGenerados = 0; // Nodos generados
+  double tiempoCPU = 0.0; // Tiempo de CPU en segundos
+};
+
+// Referencias indexadas por problema, objetivo, métrica y m
+using LineasBase = map<string, LineaBase>;
+
+string claveLineaBase(const string& problema, TipoObjetivo objetivo, Metrica metrica, int m);
+LineasBase leerLineasBase(const string& ruta);
+void guardarLineasBase(const string& ruta, const LineasBase& lineas);
+
+double calcularOptimoFuerzaBruta(const Dato& dato, int m, TipoObjetivo objetivo);
+int verificar(const Opciones& opciones);
+
+#endif